@@ -0,0 +1,10 @@
+#!/bin/bash
+
+# Build the benchmarks using CMake
+mkdir -p build
+cd build
+cmake .. -DCMAKE_BUILD_TYPE=Release -DBUILD_BENCHMARKS=ON
+cmake --build . --target regex-to-dfa-benchmarks
+
+# Run the benchmarks, forwarding any Google Benchmark flags
+./regex-to-dfa-benchmarks "$@"
@@ -0,0 +1,295 @@
+/**
+ * @file automata.bench.cpp
+ * @author Carlos Salguero
+ * @brief Benchmarks of the NFA construction and the DFA conversion
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+// C++ Standard Library
+#include <memory>
+#include <string>
+#include <vector>
+
+// Google Benchmark
+#include <benchmark/benchmark.h>
+
+// Project files
+#include "corpus.h"
+#include "../src/automata/automata.h"
+#include "../src/automata/minimizer.h"
+#include "../src/graph/closure_table.h"
+#include "../src/graph/graph.h"
+#include "../src/regex/pattern_set.h"
+#include "../src/regex/regex_cache.h"
+
+// Benchmarks
+/**
+ * @brief
+ * Thompson construction of a literal, parameterized over its length
+ * @param state Benchmark state
+ */
+static void BM_BuildLiteral(benchmark::State &state)
+{
+    const std::string pattern = literal_pattern(state.range(0));
+
+    for (auto _ : state)
+    {
+        Automata automata(pattern);
+        benchmark::DoNotOptimize(automata.build());
+    }
+
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_BuildLiteral)
+    ->RangeMultiplier(4)
+    ->Range(16, 16 << 10)
+    ->Complexity();
+
+/**
+ * @brief
+ * Thompson construction of an alternation, parameterized over its width
+ * @param state Benchmark state
+ */
+static void BM_BuildAlternation(benchmark::State &state)
+{
+    const std::string pattern = alternation_pattern(state.range(0));
+
+    for (auto _ : state)
+    {
+        Automata automata(pattern);
+        benchmark::DoNotOptimize(automata.build());
+    }
+
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_BuildAlternation)
+    ->RangeMultiplier(4)
+    ->Range(4, 4 << 10)
+    ->Complexity();
+
+/**
+ * @brief
+ * Thompson construction of nested stars, parameterized over the depth
+ * @param state Benchmark state
+ */
+static void BM_BuildNestedStar(benchmark::State &state)
+{
+    const std::string pattern = nested_star_pattern(state.range(0));
+
+    for (auto _ : state)
+    {
+        Automata automata(pattern);
+        benchmark::DoNotOptimize(automata.build());
+    }
+}
+BENCHMARK(BM_BuildNestedStar)->DenseRange(1, 16, 5);
+
+/**
+ * @brief
+ * Thompson construction of a counted repetition of a small group,
+ * parameterized over the upper bound
+ * @param state Benchmark state
+ */
+static void BM_BuildCountedRepetition(benchmark::State &state)
+{
+    const std::string pattern =
+        "(ab|c[d-f]){1," + std::to_string(state.range(0)) + "}";
+
+    for (auto _ : state)
+    {
+        Automata automata(pattern);
+        benchmark::DoNotOptimize(automata.build());
+    }
+
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_BuildCountedRepetition)
+    ->RangeMultiplier(4)
+    ->Range(4, 1000)
+    ->Complexity();
+
+/**
+ * @brief
+ * Epsilon closure of the start vertex through Graph::e_closure, over nested
+ * stars whose closure reaches most of the NFA
+ * @param state Benchmark state
+ */
+static void BM_EClosure(benchmark::State &state)
+{
+    Automata automata(nested_star_pattern(state.range(0)));
+    std::shared_ptr<Graph> nfa = automata.build();
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(nfa->e_closure(nfa->get_start()));
+}
+BENCHMARK(BM_EClosure)->DenseRange(1, 16, 5);
+
+/**
+ * @brief
+ * Epsilon closure of the start vertex through a precomputed ClosureTable
+ * @param state Benchmark state
+ */
+static void BM_ClosureTable(benchmark::State &state)
+{
+    Automata automata(nested_star_pattern(state.range(0)));
+    std::shared_ptr<Graph> nfa = automata.build();
+
+    ClosureTable closures(*nfa);
+    StateSet from(nfa->get_next());
+    StateSet to(nfa->get_next());
+    from.insert(nfa->get_start());
+
+    for (auto _ : state)
+    {
+        closures.close(from, to);
+        benchmark::DoNotOptimize(to);
+    }
+}
+BENCHMARK(BM_ClosureTable)->DenseRange(1, 16, 5);
+
+/**
+ * @brief
+ * Hangs copies of an NFA from one vertex, parameterized over the number
+ * of copies
+ * @param state Benchmark state
+ */
+static void BM_ConnectGraphToVertex(benchmark::State &state)
+{
+    Automata automata(alternation_pattern(16));
+    std::shared_ptr<Graph> nfa = automata.build();
+
+    for (auto _ : state)
+    {
+        Graph graph;
+        int start = graph.create_vertex();
+
+        for (int i = 0; i < state.range(0); i++)
+            benchmark::DoNotOptimize(
+                graph.connect_graph_to_vertex(nfa, start));
+
+        graph.freeze();
+    }
+
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_ConnectGraphToVertex)
+    ->RangeMultiplier(4)
+    ->Range(1, 256)
+    ->Complexity();
+
+/**
+ * @brief
+ * Subset construction of an alternation, parameterized over its width
+ * @param state Benchmark state
+ */
+static void BM_TransformDfaAlternation(benchmark::State &state)
+{
+    Automata automata(alternation_pattern(state.range(0)));
+    automata.build();
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(automata.transform_dfa());
+
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_TransformDfaAlternation)
+    ->RangeMultiplier(4)
+    ->Range(4, 1 << 10)
+    ->Complexity();
+
+/**
+ * @brief
+ * Adding one pattern to a compiled PatternSet of state.range(0) keywords,
+ * compiling only the delta level or rebuilding the whole set
+ * @param state Benchmark state
+ * @param full Whether to rebuild the whole set instead of the delta
+ */
+static void BM_PatternSetUpdate(benchmark::State &state, const bool full)
+{
+    PatternSet patterns;
+
+    for (int i = 0; i < state.range(0); i++)
+        patterns.add("key" + std::to_string(i) + "[a-z]*");
+
+    patterns.rebuild();
+
+    for (auto _ : state)
+    {
+        int id = patterns.add("new[0-9]+");
+
+        if (full)
+            patterns.rebuild();
+        else
+            patterns.compile();
+
+        benchmark::DoNotOptimize(patterns.scan("key7abc new42"));
+        patterns.remove(id);
+    }
+}
+BENCHMARK_CAPTURE(BM_PatternSetUpdate, delta, false)
+    ->RangeMultiplier(8)
+    ->Range(8, 1 << 9);
+BENCHMARK_CAPTURE(BM_PatternSetUpdate, rebuild, true)
+    ->RangeMultiplier(8)
+    ->Range(8, 1 << 9);
+
+/**
+ * @brief
+ * Subset construction and minimization of every pattern of the corpus
+ * @param state Benchmark state
+ * @param expression Pattern of the corpus
+ */
+static void BM_Compile(benchmark::State &state, const char *expression)
+{
+    for (auto _ : state)
+    {
+        Automata automata(expression);
+        Minimizer minimizer;
+
+        benchmark::DoNotOptimize(minimizer.minimize(*automata.transform_dfa()));
+    }
+}
+
+/**
+ * @brief
+ * Lookup of every realistic pattern of the corpus in a warm RegexCache, to
+ * be compared with compiling them through BM_Compile
+ * @param state Benchmark state
+ */
+static void BM_RegexCacheHit(benchmark::State &state)
+{
+    RegexCache cache;
+
+    for (const CorpusPattern &pattern : REALISTIC_PATTERNS)
+        cache.get(pattern.expression);
+
+    for (auto _ : state)
+        for (const CorpusPattern &pattern : REALISTIC_PATTERNS)
+            benchmark::DoNotOptimize(cache.get(pattern.expression));
+
+    state.SetItemsProcessed(state.iterations() * REALISTIC_PATTERNS.size());
+}
+BENCHMARK(BM_RegexCacheHit);
+
+/**
+ * @brief
+ * Registers BM_Compile once per pattern of the corpus
+ * @return true always
+ */
+static bool register_compile_benchmarks()
+{
+    for (const std::vector<CorpusPattern> *corpus :
+         {&REALISTIC_PATTERNS, &ADVERSARIAL_PATTERNS})
+        for (const CorpusPattern &pattern : *corpus)
+            benchmark::RegisterBenchmark(
+                (std::string("BM_Compile/") + pattern.name).c_str(),
+                BM_Compile, pattern.expression);
+
+    return true;
+}
+
+static const bool compile_benchmarks = register_compile_benchmarks();
@@ -0,0 +1,138 @@
+/**
+ * @file corpus.h
+ * @author Carlos Salguero
+ * @brief Patterns and inputs shared by the benchmarks
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef CORPUS_H
+#define CORPUS_H
+
+// C++ Standard Library
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Structs
+/**
+ * @struct CorpusPattern
+ * @brief Named pattern of the benchmark corpus
+ */
+struct CorpusPattern
+{
+    const char *name;
+    const char *expression;
+};
+
+// Constants
+/**
+ * @brief Realistic patterns, written for the operators of the parser.
+ * Upper case 'E' is the epsilon symbol, so the words are lower case
+ */
+inline const std::vector<CorpusPattern> REALISTIC_PATTERNS = {
+    {"keyword", "(while)|(for)|(if)|(return)|(switch)"},
+    {"identifier", "(a|b|c|d|e|f|g|h)(a|b|c|d|e|f|g|h|0|1|2|3)*"},
+    {"number", "(0|1|2|3|4|5|6|7|8|9)+"},
+    {"http_method", "((get)|(post)|(put)|(delete)) /"},
+    {"log_level", "((info)|(warn)|(error)): (a|b|c)+"},
+};
+
+/**
+ * @brief Adversarial patterns: deep epsilon chains, nested stars and a DFA
+ * that is exponential in the distance of the last 'a' from the end
+ */
+inline const std::vector<CorpusPattern> ADVERSARIAL_PATTERNS = {
+    {"nested_star", "((((a*)*)*)*)*b"},
+    {"star_of_union", "((a|b)*(a|b)*(a|b)*)*c"},
+    {"kth_from_end", "(a|b)*a(a|b)(a|b)(a|b)(a|b)(a|b)(a|b)(a|b)"},
+    {"redundant_union", "(a|a|a|a|a|a|a|a)*(b|b|b|b)"},
+};
+
+// Functions
+/**
+ * @brief
+ * Builds a literal of the given length over a small alphabet
+ * @param length Length of the pattern
+ * @return std::string pattern
+ */
+inline std::string literal_pattern(const int &length)
+{
+    std::string pattern;
+
+    for (int i = 0; i < length; i++)
+        pattern += static_cast<char>('a' + i % 4);
+
+    return pattern;
+}
+
+/**
+ * @brief
+ * Builds an alternation of distinct four letter words
+ * @param width Number of alternatives
+ * @return std::string pattern
+ */
+inline std::string alternation_pattern(const int &width)
+{
+    std::string pattern;
+
+    for (int i = 0; i < width; i++)
+    {
+        if (i > 0)
+            pattern += '|';
+
+        pattern += '(';
+
+        for (int digit = 0, value = i; digit < 4; digit++, value /= 8)
+            pattern += static_cast<char>('a' + value % 8);
+
+        pattern += ')';
+    }
+
+    return pattern;
+}
+
+/**
+ * @brief
+ * Builds a star nested to the given depth, followed by a literal
+ * @param depth Number of nested stars
+ * @return std::string pattern
+ */
+inline std::string nested_star_pattern(const int &depth)
+{
+    std::string pattern = "a";
+
+    for (int i = 0; i < depth; i++)
+        pattern = "(" + pattern + "|b)*";
+
+    return pattern + "c";
+}
+
+/**
+ * @brief
+ * Builds a deterministic pseudo-random input over the given alphabet
+ * @param size Length of the input
+ * @param alphabet Bytes the input is drawn from
+ * @return std::string input
+ */
+inline std::string random_input(const std::size_t &size,
+                                const std::string &alphabet)
+{
+    std::string input(size, ' ');
+    std::uint32_t seed = 0x9e3779b9;
+
+    for (char &character : input)
+    {
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        character = alphabet[seed % alphabet.size()];
+    }
+
+    return input;
+}
+
+#endif //! CORPUS_H
@@ -0,0 +1,240 @@
+/**
+ * @file matcher.bench.cpp
+ * @author Carlos Salguero
+ * @brief Benchmarks of the matching engines
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+// C++ Standard Library
+#include <memory>
+#include <string>
+#include <vector>
+
+// Google Benchmark
+#include <benchmark/benchmark.h>
+
+// Project files
+#include "corpus.h"
+#include "../src/automata/automata.h"
+#include "../src/automata/minimizer.h"
+#include "../src/matcher/lazy_dfa.h"
+#include "../src/matcher/matcher.h"
+#include "../src/matcher/parallel_scanner.h"
+#include "../src/matcher/prefilter.h"
+#include "../src/matcher/span_matcher.h"
+#include "../src/regex/regex.h"
+
+// Constants
+constexpr std::size_t INPUT_SIZE = 1 << 20;
+const std::string NOISE_ALPHABET = "jkmqvxyzJKMQVXYZ";
+
+// Benchmarks
+/**
+ * @brief
+ * Anchored match of the dense DFA over an input that stays alive, which
+ * is the worst case for early exit
+ * @param state Benchmark state
+ */
+static void BM_MatcherMatch(benchmark::State &state)
+{
+    Automata automata("(a|b)*abb");
+    Minimizer minimizer;
+    Matcher matcher(*minimizer.minimize(*automata.transform_dfa()));
+
+    const std::string input = random_input(state.range(0), "ab");
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(matcher.match(input));
+
+    state.SetBytesProcessed(state.iterations() * input.size());
+}
+BENCHMARK(BM_MatcherMatch)->RangeMultiplier(16)->Range(64, INPUT_SIZE);
+
+/**
+ * @brief
+ * Vectorized search for a literal absent from the input, parameterized
+ * over the length of the literal
+ * @param state Benchmark state
+ */
+static void BM_Prefilter(benchmark::State &state)
+{
+    Prefilter prefilter(std::string(state.range(0), 'a'));
+
+    const std::string input = random_input(INPUT_SIZE, NOISE_ALPHABET);
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(prefilter.find(input));
+
+    state.SetBytesProcessed(state.iterations() * input.size());
+}
+BENCHMARK(BM_Prefilter)->DenseRange(1, 4)->Arg(16);
+
+/**
+ * @brief
+ * Counts the match ends of a large input split across threads, with each
+ * strategy, parameterized over the number of threads
+ * @param state Benchmark state
+ * @param strategy How chunks are scanned before their start state is known
+ */
+static void BM_ParallelScan(benchmark::State &state,
+                            const ParallelStrategy strategy)
+{
+    Automata automata("(a|b)*a(a|b)(a|b)");
+    auto matcher = std::make_shared<const Matcher>(*automata.transform_dfa());
+    ParallelScanner scanner(matcher, state.range(0), strategy);
+
+    const std::string input = random_input(64 * INPUT_SIZE, "abc");
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(scanner.count(input));
+
+    state.SetBytesProcessed(state.iterations() * input.size());
+}
+BENCHMARK_CAPTURE(BM_ParallelScan, enumerate, ParallelStrategy::ENUMERATE)
+    ->RangeMultiplier(2)
+    ->Range(1, 32)
+    ->UseRealTime();
+BENCHMARK_CAPTURE(BM_ParallelScan, speculate, ParallelStrategy::SPECULATE)
+    ->RangeMultiplier(2)
+    ->Range(1, 32)
+    ->UseRealTime();
+
+/**
+ * @brief
+ * Offsets of every match of an expression, found with the reverse DFA of
+ * SpanMatcher or by restarting the anchored DFA at every offset. Restarts
+ * are quadratic when the anchored DFA stays alive without matching.
+ * @param state Benchmark state
+ * @param expression Regular expression
+ * @param alphabet Bytes the random input is drawn from
+ * @param restart Whether to restart at every offset instead
+ */
+static void BM_FindAll(benchmark::State &state, const char *expression,
+                       const char *alphabet, const bool restart)
+{
+    const std::string input = random_input(state.range(0), alphabet);
+    SpanMatcher spans(*Automata(expression).build());
+    const Matcher &forward = spans.get_forward();
+
+    for (auto _ : state)
+    {
+        if (!restart)
+        {
+            benchmark::DoNotOptimize(spans.find_all(input));
+            continue;
+        }
+
+        std::vector<MatchSpan> matches;
+
+        for (std::size_t from = 0; from < input.size();)
+        {
+            std::uint32_t current = forward.get_start();
+            std::size_t end = 0;
+
+            for (std::size_t i = from; i < input.size() && current != 0; i++)
+            {
+                current = forward.step(current, input[i]);
+
+                if (forward.is_accepting(current))
+                    end = i + 1;
+            }
+
+            if (end > from)
+                matches.push_back({from, end});
+
+            from = end > from ? end : from + 1;
+        }
+
+        benchmark::DoNotOptimize(matches);
+    }
+
+    state.SetBytesProcessed(state.iterations() * input.size());
+}
+BENCHMARK_CAPTURE(BM_FindAll, numbers/reverse_dfa, "[0-9]+(\\.[0-9]+)*",
+                  "0123456789. x", false)
+    ->RangeMultiplier(16)
+    ->Range(64, INPUT_SIZE);
+BENCHMARK_CAPTURE(BM_FindAll, numbers/restart, "[0-9]+(\\.[0-9]+)*",
+                  "0123456789. x", true)
+    ->RangeMultiplier(16)
+    ->Range(64, INPUT_SIZE);
+BENCHMARK_CAPTURE(BM_FindAll, no_match/reverse_dfa, "[a-z]+[0-9]",
+                  "abcdefghijklmnopqrstuvwxyz", false)
+    ->RangeMultiplier(4)
+    ->Range(64, 1 << 14);
+BENCHMARK_CAPTURE(BM_FindAll, no_match/restart, "[a-z]+[0-9]",
+                  "abcdefghijklmnopqrstuvwxyz", true)
+    ->RangeMultiplier(4)
+    ->Range(64, 1 << 14);
+
+/**
+ * @brief
+ * Unanchored search of every engine for a pattern of the corpus, over a
+ * haystack that never matches so that every engine scans all of it
+ * @param state Benchmark state
+ * @param expression Pattern of the corpus
+ * @param engine 0 for the dense DFA, 1 for the lazy DFA and 2 for Regex
+ */
+static void BM_Find(benchmark::State &state, const char *expression,
+                    const int engine)
+{
+    const std::string input = random_input(INPUT_SIZE, NOISE_ALPHABET);
+
+    Automata automata(expression);
+    std::shared_ptr<Graph> nfa = automata.build();
+
+    if (engine == 0)
+    {
+        Minimizer minimizer;
+        Matcher matcher(*minimizer.minimize(*automata.transform_dfa()));
+
+        for (auto _ : state)
+            benchmark::DoNotOptimize(matcher.find(input));
+    }
+
+    else if (engine == 1)
+    {
+        LazyDfa lazy(nfa);
+
+        for (auto _ : state)
+            benchmark::DoNotOptimize(lazy.find(input));
+    }
+
+    else
+    {
+        Regex regex(expression);
+
+        for (auto _ : state)
+            benchmark::DoNotOptimize(regex.find(input));
+    }
+
+    state.SetBytesProcessed(state.iterations() * input.size());
+}
+
+/**
+ * @brief
+ * Registers BM_Find once per engine and pattern of the corpus
+ * @return true always
+ */
+static bool register_find_benchmarks()
+{
+    const char *engines[] = {"dfa", "lazy_dfa", "regex"};
+
+    for (const std::vector<CorpusPattern> *corpus :
+         {&REALISTIC_PATTERNS, &ADVERSARIAL_PATTERNS})
+        for (const CorpusPattern &pattern : *corpus)
+            for (int engine = 0; engine < 3; engine++)
+                benchmark::RegisterBenchmark(
+                    (std::string("BM_Find/") + pattern.name + "/" +
+                     engines[engine])
+                        .c_str(),
+                    BM_Find, pattern.expression, engine);
+
+    return true;
+}
+
+static const bool find_benchmarks = register_find_benchmarks();
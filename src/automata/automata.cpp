@@ -10,9 +10,13 @@
  */
 
 // C++ Standard Library
+#include <algorithm>
+#include <stdexcept>
+#include <unordered_map>
 
 // Project files
 #include "automata.h"
+#include "../parser/simplifier.h"
 
 // Constructors
 /**
@@ -21,279 +25,473 @@
  * @param expression Regular expression
  */
 Automata::Automata(const std::string &expression)
-    : m_reg_expression(expression)
+    : m_reg_expression(expression), m_vertexes(0)
 {
 }
 
 // Methods (public)
 /**
  * @brief
- * Builds the NFA from the regular expression
+ * Builds the NFA from the regular expression. The expression is parsed and
+ * simplified first, then every fragment is built in one edge arena and
+ * operators only stitch fragments together, so the construction is linear
+ * in the size of the simplified tree.
  * @return std::shared_ptr<Graph> NFA
+ * @throws std::invalid_argument if the expression is malformed
  */
 std::shared_ptr<Graph> Automata::build()
 {
-    TokenType last_token = TokenType::OPERATOR;
+    Ast ast = Simplifier(Parser(m_reg_expression).parse()).simplify();
 
-    for (const char &character : m_reg_expression)
-    {
-        switch (character)
-        {
-        case '(':
-            if (last_token == TokenType::OPERAND)
-                m_operators.push(CONCAT_OPERATOR);
-
-            m_operators.push(character);
-            last_token = TokenType::OPERATOR;
+    m_edges.clear();
+    m_edges.reserve(4 * ast.size() + 1);
+    m_vertexes = 0;
 
-            break;
+    Fragment fragment = emit(ast, ast.get_root());
 
-        case ')':
-            while (!m_operators.empty())
-            {
-                char operator_ = m_operators.top();
-                m_operators.pop();
+    m_graph = std::make_shared<Graph>(m_vertexes, m_edges);
+    m_graph->set_start(fragment.start);
+    m_graph->add_final(fragment.end);
 
-                if (operator_ == '(')
-                    break;
+    std::vector<Edge>().swap(m_edges);
+    return std::shared_ptr<Graph>(m_graph);
+}
 
-                apply_operator(operator_);
-            }
+/**
+ * @brief
+ * Transforms the NFA into a DFA through the subset construction, with the
+ * byte classes of the edges of the NFA
+ * @return std::shared_ptr<Graph> DFA
+ */
+std::shared_ptr<Graph> Automata::transform_dfa()
+{
+    if (!m_graph)
+        build();
 
-            last_token = TokenType::OPERAND;
-            break;
+    return determinize(*m_graph, ByteClasses(*m_graph));
+}
 
-        case '*':
-        case '+':
-            apply_operator(character);
-            break;
+/**
+ * @brief
+ * Transforms an NFA into a DFA through the subset construction. Every set
+ * of NFA vertexes is kept as a dense bitset, the DFA states are
+ * deduplicated through a hash table keyed on those bitsets, moves are
+ * computed once per byte class instead of once per byte, and epsilon
+ * closures come from a ClosureTable computed once per NFA. A DFA state is
+ * final when its set has a final vertex, and carries the ids of all of
+ * them.
+ * @param nfa NFA to be transformed
+ * @param classes Byte classes, every edge of the NFA must respect them
+ * @param max_states Largest number of DFA states to be built
+ * @return std::shared_ptr<Graph> DFA
+ * @throws std::length_error if the DFA needs more than max_states states
+ */
+std::shared_ptr<Graph> Automata::determinize(const Graph &nfa,
+                                             const ByteClasses &classes,
+                                             const std::size_t &max_states)
+{
+    const int nfa_size = nfa.get_next();
+    const ClosureTable closures(nfa);
 
-        case CONCAT_OPERATOR:
-        case '|':
-            m_operators.push(character);
-            last_token = TokenType::OPERATOR;
+    const std::vector<unsigned char> representatives =
+        classes.get_representatives();
 
-            break;
+    std::vector<std::vector<std::pair<unsigned char, unsigned char>>> ranges(
+        classes.get_class_count());
+    for (int class_id = 0; class_id < classes.get_class_count(); class_id++)
+        ranges[class_id] = classes.get_ranges(class_id);
 
-        default:
-            if (last_token == TokenType::OPERAND)
-                m_operators.push(CONCAT_OPERATOR);
+    StateSet nfa_final(nfa_size);
+    for (const int &final : nfa.get_final())
+        nfa_final.insert(final);
 
-            last_token = TokenType::OPERAND;
-            std::shared_ptr<Graph> graph = std::make_shared<Graph>();
+    std::shared_ptr<Graph> dfa = std::make_shared<Graph>();
+    std::unordered_map<StateSet, int, StateSetHash> states;
+    std::vector<StateSet> subsets;
 
-            int start = graph->create_vertex();
-            int end = graph->create_vertex();
+    auto add_state = [&](const StateSet &set)
+    {
+        if (subsets.size() == max_states)
+            throw std::length_error("the DFA exceeds " +
+                                    std::to_string(max_states) + " states");
 
-            graph->set_start(start);
-            graph->add_final({end});
+        int vertex = dfa->create_vertex();
 
-            graph->add_edge(start, character, end);
-            m_expressions.push(graph);
+        if (set.intersects(nfa_final))
+        {
+            dfa->add_final(vertex);
 
-            if (character != EPSILON)
-                m_alphabet.insert(character);
+            set.for_each([&](int member)
+                         {
+                if (!nfa_final.contains(member))
+                    return;
 
-            break;
+                for (const int &id : nfa.get_final_ids(member))
+                    dfa->add_final(vertex, id); });
         }
-    }
 
-    while (!m_operators.empty())
+        subsets.push_back(set);
+        return vertex;
+    };
+
+    StateSet moved(nfa_size);
+    moved.insert(nfa.get_start());
+
+    StateSet next(nfa_size);
+    closures.close(moved, next);
+
+    dfa->set_start(add_state(next));
+    states.emplace(next, dfa->get_start());
+
+    for (std::size_t current = 0; current < subsets.size(); current++)
     {
-        char operator_ = m_operators.top();
-        m_operators.pop();
+        for (int class_id = 0; class_id < classes.get_class_count(); class_id++)
+        {
+            move(nfa, subsets[current], representatives[class_id], moved);
 
-        apply_operator(operator_);
+            if (moved.empty())
+                continue;
+
+            closures.close(moved, next);
+
+            auto [it, inserted] = states.try_emplace(next, dfa->get_next());
+
+            if (inserted)
+                add_state(next);
+
+            for (const auto &[low, high] : ranges[class_id])
+                dfa->add_edge(static_cast<int>(current), low, high, it->second);
+        }
     }
 
-    m_graph = m_expressions.top();
-    return std::shared_ptr<Graph>(m_graph);
+    dfa->freeze();
+    return dfa;
 }
 
-// Methods (private)
 /**
  * @brief
- * Apply the star operator to a graph. The star operator is applied to the
- * graph passed as parameter and the result is returned.
- * @param graph Graph to apply the operator
- * @return std::shared_ptr<Graph> Graph with the operator applied
+ * Reverses an NFA: every edge is flipped and the start and final vertexes
+ * swap roles, so the result accepts the reverse of every input the NFA
+ * accepts. Several final vertexes are joined under a new start vertex.
+ * @param nfa NFA to be reversed
+ * @return std::shared_ptr<Graph> reversed NFA, frozen
  */
-std::shared_ptr<Graph> Automata::star(const std::shared_ptr<Graph> &graph)
+std::shared_ptr<Graph> Automata::reverse(const Graph &nfa)
 {
-    int graph_start = graph->get_start();
-    int graph_final = *graph->get_final().begin();
+    const std::set<int> &finals = nfa.get_final();
+    int vertexes = nfa.get_next();
+    std::vector<Edge> edges;
+    edges.reserve(nfa.get_edge_count() + finals.size());
+
+    for (int vertex = 0; vertex < nfa.get_next(); vertex++)
+    {
+        for (const Transition &transition : nfa.get_edges(vertex))
+            edges.push_back({transition.to, transition.low, transition.high,
+                             vertex});
+
+        for (const int &to : nfa.get_epsilon_edges(vertex))
+            edges.push_back({to, 0, 0, vertex, true});
+    }
+
+    const int start = finals.size() == 1 ? *finals.begin() : vertexes++;
 
-    std::shared_ptr<Graph> new_graph = std::make_shared<Graph>();
-    int start = new_graph->create_vertex();
-    new_graph->set_start(start);
+    if (finals.size() != 1)
+        for (const int &final : finals)
+            edges.push_back({start, 0, 0, final, true});
 
-    int next = new_graph->create_vertex();
-    new_graph->add_edge(start, EPSILON, next);
+    std::shared_ptr<Graph> reversed = std::make_shared<Graph>(vertexes, edges);
+    reversed->set_start(start);
+    reversed->add_final(nfa.get_start());
 
-    auto [new_start, new_end] = new_graph->connect_graph_to_vertex(graph, next);
-    new_graph->add_edge(new_end, EPSILON, new_start);
+    return reversed;
+}
 
-    int end = new_graph->create_vertex();
-    new_graph->add_final({end});
+// Methods (private)
+/**
+ * @brief
+ * Creates a new vertex in the arena
+ * @return int new vertex
+ */
+int Automata::create_vertex()
+{
+    return m_vertexes++;
+}
 
-    new_graph->add_edge(start, EPSILON, end);
-    new_graph->add_edge(new_end, EPSILON, end);
+/**
+ * @brief
+ * Adds an edge labeled with a range of bytes to the arena
+ * @param from Origin vertex
+ * @param low Smallest byte of the range
+ * @param high Largest byte of the range
+ * @param to Destination vertex
+ */
+void Automata::add_edge(const int &from, const unsigned char &low,
+                        const unsigned char &high, const int &to)
+{
+    m_edges.push_back({from, low, high, to});
+}
 
-    return new_graph;
+/**
+ * @brief
+ * Adds an epsilon edge to the arena
+ * @param from Origin vertex
+ * @param to Destination vertex
+ */
+void Automata::add_epsilon(const int &from, const int &to)
+{
+    m_edges.push_back({from, 0, 0, to, true});
 }
 
 /**
  * @brief
- * Apply the plus operator to a graph. The plus operator is applied to the
- * graph passed as parameter and the result is returned.
- * @param graph Graph to apply the operator
- * @return std::shared_ptr<Graph> Graph with the operator applied
+ * Builds the fragment matching one byte of a set, with one edge per range
+ * of consecutive bytes rather than one per byte. An empty set has no edge
+ * at all, so its fragment matches nothing.
+ * @param set Bytes to be matched
+ * @return Fragment Fragment of the set
  */
-std::shared_ptr<Graph> Automata::plus(const std::shared_ptr<Graph> &graph)
+Fragment Automata::symbol(const ByteSet &set)
 {
-    int graph_start = graph->get_start();
-    int graph_final = *graph->get_final().begin();
+    int start = create_vertex();
+    int end = create_vertex();
 
-    std::shared_ptr<Graph> new_graph = std::make_shared<Graph>();
-    int start = new_graph->create_vertex();
-    new_graph->set_start(start);
+    for (const ByteRange &range : set.ranges())
+        add_edge(start, range.low, range.high, end);
 
-    int next = new_graph->create_vertex();
-    new_graph->add_edge(start, EPSILON, next);
+    return {start, end};
+}
 
-    auto [new_start, new_end] = new_graph->connect_graph_to_vertex(graph, next);
-    new_graph->add_edge(new_end, EPSILON, new_start);
+/**
+ * @brief
+ * Apply the star operator to a fragment. The star operator is applied to
+ * the fragment passed as parameter and the result is returned.
+ * @param fragment Fragment to apply the operator
+ * @return Fragment Fragment with the operator applied
+ */
+Fragment Automata::star(const Fragment &fragment)
+{
+    int start = create_vertex();
+    int end = create_vertex();
 
-    int end = new_graph->create_vertex();
-    new_graph->add_final({end});
-    new_graph->add_edge(new_end, EPSILON, end);
+    add_epsilon(start, fragment.start);
+    add_epsilon(fragment.end, fragment.start);
+    add_epsilon(fragment.end, end);
+    add_epsilon(start, end);
 
-    return new_graph;
+    return {start, end};
 }
 
 /**
  * @brief
- * Apply the concatenation operator to two graphs. The concatenation operator
- * is applied to the graphs passed as parameters and the result is returned.
- * @param left_graph First graph to concatenate
- * @param right_graph Second graph to concatenate
- * @return std::shared_ptr<Graph> Graph with the operator applied
+ * Apply the plus operator to a fragment. The plus operator is applied to
+ * the fragment passed as parameter and the result is returned.
+ * @param fragment Fragment to apply the operator
+ * @return Fragment Fragment with the operator applied
  */
-std::shared_ptr<Graph> Automata::concat(
-    const std::shared_ptr<Graph> &left_graph,
-    const std::shared_ptr<Graph> &right_graph)
+Fragment Automata::plus(const Fragment &fragment)
 {
-    int start_left = left_graph->get_start();
-    int end_left = *left_graph->get_final().begin();
+    int start = create_vertex();
+    int end = create_vertex();
 
-    int start_right = right_graph->get_start();
-    int end_right = *right_graph->get_final().begin();
+    add_epsilon(start, fragment.start);
+    add_epsilon(fragment.end, fragment.start);
+    add_epsilon(fragment.end, end);
 
-    std::shared_ptr<Graph> new_graph = std::make_shared<Graph>();
+    return {start, end};
+}
 
-    int start = new_graph->create_vertex();
-    new_graph->set_start(start);
+/**
+ * @brief
+ * Apply the concatenation operator to two fragments. The concatenation
+ * operator is applied to the fragments passed as parameters and the result
+ * is returned.
+ * @param left First fragment to concatenate
+ * @param right Second fragment to concatenate
+ * @return Fragment Fragment with the operator applied
+ */
+Fragment Automata::concat(const Fragment &left, const Fragment &right)
+{
+    add_epsilon(left.end, right.start);
 
-    auto [new_left_start, new_left_end] =
-        new_graph->connect_graph_to_vertex(left_graph, start);
+    return {left.start, right.end};
+}
 
-    auto [new_right_start, new_right_end] =
-        new_graph->connect_graph_to_vertex(right_graph, new_left_end);
+/**
+ * @brief
+ * Applies the or operator to any number of fragments. A new start vertex
+ * branches into every fragment and every fragment ends in a new final
+ * vertex.
+ * @param alternatives Fragments to apply the operator
+ * @return Fragment Fragment with the operator applied
+ */
+Fragment Automata::or_operator(const std::vector<Fragment> &alternatives)
+{
+    int start = create_vertex();
+    int end = create_vertex();
 
-    new_graph->add_final({new_right_end});
+    for (const Fragment &alternative : alternatives)
+    {
+        add_epsilon(start, alternative.start);
+        add_epsilon(alternative.end, end);
+    }
 
-    return new_graph;
+    return {start, end};
 }
 
 /**
  * @brief
- * Applies the or operator to two graphs. The or operator is applied to the
- * graphs passed as parameters and the result is returned.
- * @param left_graph First graph to apply the operator
- * @param right_graph Second graph to apply the operator
- * @return std::shared_ptr<Graph> Graph with the operator applied
+ * Applies a counted repetition to a fragment. The fragment is built once
+ * and then used as a template: every further copy is its block of vertexes
+ * and edges shifted past the end of the arena, so a copy costs one pass
+ * over the operand's edges and no walk of the syntax tree. Mandatory
+ * copies are chained, every optional copy can be skipped straight to the
+ * end, and an unbounded repetition loops on its last copy, so the edges
+ * grow linearly with the count.
+ * @param fragment Fragment of the operand, the last one built
+ * @param first_vertex First vertex of the operand's block
+ * @param first_edge First edge of the operand's block
+ * @param min Smallest number of repetitions
+ * @param max Largest number of repetitions, REPEAT_UNBOUNDED for none
+ * @return Fragment Fragment with the operator applied
  */
-std::shared_ptr<Graph> Automata::or_operator(
-    const std::shared_ptr<Graph> &left_graph,
-    const std::shared_ptr<Graph> &right_graph)
+Fragment Automata::repeat(const Fragment &fragment, const int &first_vertex,
+                          const std::size_t &first_edge, const int &min,
+                          const int &max)
 {
-    int start_left = left_graph->get_start();
-    int end_left = *left_graph->get_final().begin();
+    const int vertexes = m_vertexes - first_vertex;
+    const std::size_t edges = m_edges.size() - first_edge;
+    const int copies = max == REPEAT_UNBOUNDED ? std::max(min, 1) : max;
+
+    m_edges.reserve(m_edges.size() + (copies - 1) * edges + 2 * copies + 2);
+
+    int start = create_vertex();
+    int end = create_vertex();
+    Fragment previous = {start, start};
+
+    for (int copy = 0; copy < copies; copy++)
+    {
+        Fragment current = fragment;
+
+        if (copy > 0)
+        {
+            int offset = m_vertexes - first_vertex;
+            m_vertexes += vertexes;
 
-    int start_right = right_graph->get_start();
-    int end_right = *right_graph->get_final().begin();
+            for (std::size_t i = 0; i < edges; i++)
+            {
+                Edge edge = m_edges[first_edge + i];
 
-    std::shared_ptr<Graph> new_graph = std::make_shared<Graph>();
-    int start = new_graph->create_vertex();
-    new_graph->set_start(start);
+                edge.from += offset;
+                edge.to += offset;
+                m_edges.push_back(edge);
+            }
 
-    int next_left = new_graph->create_vertex();
-    int next_right = new_graph->create_vertex();
+            current = {fragment.start + offset, fragment.end + offset};
+        }
 
-    new_graph->add_edge(start, EPSILON, next_left);
-    new_graph->add_edge(start, EPSILON, next_right);
+        add_epsilon(previous.end, current.start);
 
-    auto [new_left_start, new_left_end] =
-        new_graph->connect_graph_to_vertex(left_graph, next_left);
+        if (copy >= min)
+            add_epsilon(current.start, end);
 
-    auto [new_right_start, new_right_end] =
-        new_graph->connect_graph_to_vertex(right_graph, next_right);
+        previous = current;
+    }
 
-    int end = new_graph->create_vertex();
-    new_graph->add_final({end});
+    if (max == REPEAT_UNBOUNDED)
+        add_epsilon(previous.end, previous.start);
 
-    new_graph->add_edge(new_left_end, EPSILON, end);
-    new_graph->add_edge(new_right_end, EPSILON, end);
+    add_epsilon(previous.end, end);
 
-    return new_graph;
+    return {start, end};
 }
 
 /**
  * @brief
- * Applies an operator to the expression.
- * @param operator Operator to apply
+ * Builds the fragment of a subtree of the syntax tree
+ * @param ast Syntax tree
+ * @param index Index of the subtree
+ * @return Fragment Fragment of the subtree
  */
-void Automata::apply_operator(const char &operator_)
+Fragment Automata::emit(const Ast &ast, const int &index)
 {
-    if (operator_ == '*')
+    const Node &node = ast.get_node(index);
+
+    switch (node.type)
+    {
+    case NodeType::LITERAL:
     {
-        std::shared_ptr<Graph> graph = m_expressions.top();
-        m_expressions.pop();
+        ByteSet set;
+        set.insert(static_cast<unsigned char>(node.symbol));
 
-        std::shared_ptr<Graph> new_graph = star(graph);
-        m_expressions.push(new_graph);
+        return symbol(set);
     }
 
-    else if (operator_ == '+')
+    case NodeType::CLASS:
+        return symbol(node.set);
+
+    case NodeType::CONCAT:
     {
-        std::shared_ptr<Graph> graph = m_expressions.top();
-        m_expressions.pop();
+        Fragment fragment = emit(ast, node.children[0]);
+
+        for (std::size_t i = 1; i < node.children.size(); i++)
+            fragment = concat(fragment, emit(ast, node.children[i]));
 
-        std::shared_ptr<Graph> new_graph = plus(graph);
-        m_expressions.push(new_graph);
+        return fragment;
     }
 
-    else if (operator_ == CONCAT_OPERATOR)
+    case NodeType::ALTERNATE:
     {
-        std::shared_ptr<Graph> right_graph = m_expressions.top();
-        m_expressions.pop();
+        std::vector<Fragment> alternatives;
 
-        std::shared_ptr<Graph> left_graph = m_expressions.top();
-        m_expressions.pop();
+        for (const int &child : node.children)
+            alternatives.push_back(emit(ast, child));
 
-        std::shared_ptr<Graph> new_graph = concat(left_graph, right_graph);
-        m_expressions.push(new_graph);
+        return or_operator(alternatives);
     }
 
-    else if (operator_ == '|')
+    case NodeType::STAR:
+        return star(emit(ast, node.children[0]));
+
+    case NodeType::PLUS:
+        return plus(emit(ast, node.children[0]));
+
+    case NodeType::REPEAT:
     {
-        std::shared_ptr<Graph> right_graph = m_expressions.top();
-        m_expressions.pop();
+        int first_vertex = m_vertexes;
+        std::size_t first_edge = m_edges.size();
+        Fragment operand = emit(ast, node.children[0]);
+
+        return repeat(operand, first_vertex, first_edge, node.min, node.max);
+    }
 
-        std::shared_ptr<Graph> left_graph = m_expressions.top();
-        m_expressions.pop();
+    default:
+    {
+        int start = create_vertex();
+        int end = create_vertex();
 
-        std::shared_ptr<Graph> new_graph = or_operator(left_graph, right_graph);
-        m_expressions.push(new_graph);
+        add_epsilon(start, end);
+        return {start, end};
+    }
     }
-}
\ No newline at end of file
+}
+
+/**
+ * @brief
+ * Computes the set of NFA vertexes reachable from a set through one edge
+ * holding a byte. With the representative of a byte class, this is the move
+ * on the whole class.
+ * @param nfa NFA whose edges are followed
+ * @param set Origin set of vertexes
+ * @param byte Byte the edges must hold
+ * @param result Destination set, cleared before being filled
+ */
+void Automata::move(const Graph &nfa, const StateSet &set,
+                    const unsigned char &byte, StateSet &result)
+{
+    result.clear();
+    set.for_each([&](int vertex)
+                 {
+        for (const Transition &transition : nfa.get_edges(vertex))
+            if (transition.contains(byte))
+                result.insert(transition.to); });
+}
@@ -13,20 +13,42 @@
 #define AUTOMATA_H
 
 // C++ Standard Library
+#include <cstddef>
+#include <cstdint>
 #include <string>
-#include <stack>
 #include <memory>
+#include <vector>
 
 // Project files
-#include "../Graph/graph.h"
+#include "../graph/graph.h"
+#include "../graph/closure_table.h"
+#include "../graph/state_set.h"
+#include "../parser/ast.h"
+#include "../parser/byte_set.h"
+#include "../parser/parser.h"
+#include "byte_classes.h"
 
-// Constants
-constexpr char CONCAT_OPERATOR = '.';
+// Structs
+/**
+ * @struct Fragment
+ * @brief Sub-automaton of the Thompson construction, given by its start
+ * and final vertexes inside the NFA being built
+ */
+struct Fragment
+{
+    int start;
+    int end;
+};
 
 // Class
 /**
  * @class Automata
- * @brief Class that represents an NFA or DFA
+ * @brief Class that represents an NFA or DFA.
+ *
+ * An Automata is the compiler of one expression: build() fills an edge
+ * arena held by the object, so an Automata is used by one thread at a
+ * time. The graphs it returns do not refer back to it, and Regex is the
+ * compiled form that threads share.
  */
 class Automata
 {
@@ -42,29 +64,37 @@ public:
     std::shared_ptr<Graph> build();
     std::shared_ptr<Graph> transform_dfa();
 
+    static std::shared_ptr<Graph> determinize(
+        const Graph &, const ByteClasses &,
+        const std::size_t &max_states = SIZE_MAX);
+    static std::shared_ptr<Graph> reverse(const Graph &);
+
 private:
-    std::set<char> m_alphabet;
-    std::stack<std::shared_ptr<Graph>> m_expressions;
-    std::stack<char> m_operators;
     std::string m_reg_expression;
     std::shared_ptr<Graph> m_graph;
 
+    // Arena holding every fragment while the NFA is built
+    std::vector<Edge> m_edges;
+    int m_vertexes;
+
     // Methods
-    std::shared_ptr<Graph> star(const std::shared_ptr<Graph> &);
-    std::shared_ptr<Graph> plus(const std::shared_ptr<Graph> &);
-    std::shared_ptr<Graph> concat(const std::shared_ptr<Graph> &,
-                                  const std::shared_ptr<Graph> &);
-    std::shared_ptr<Graph> or_operator(const std::shared_ptr<Graph> &,
-                                       const std::shared_ptr<Graph> &);
+    int create_vertex();
+    void add_edge(const int &, const unsigned char &, const unsigned char &,
+                  const int &);
+    void add_epsilon(const int &, const int &);
+
+    Fragment symbol(const ByteSet &);
+    Fragment star(const Fragment &);
+    Fragment plus(const Fragment &);
+    Fragment concat(const Fragment &, const Fragment &);
+    Fragment or_operator(const std::vector<Fragment> &);
+    Fragment repeat(const Fragment &, const int &, const std::size_t &,
+                    const int &, const int &);
 
-    void apply_operator(const char &);
+    Fragment emit(const Ast &, const int &);
 
-    // Enums
-    enum class TokenType
-    {
-        OPERATOR,
-        OPERAND
-    };
+    static void move(const Graph &, const StateSet &, const unsigned char &,
+                     StateSet &);
 };
 
 #endif //! AUTOMATA_H
\ No newline at end of file
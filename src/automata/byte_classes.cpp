@@ -0,0 +1,215 @@
+/**
+ * @file byte_classes.cpp
+ * @author Carlos Salguero
+ * @brief Implementation of the ByteClasses class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+// C++ Standard Library
+#include <algorithm>
+#include <map>
+
+// Project files
+#include "byte_classes.h"
+
+// Constructors
+/**
+ * @brief
+ * Construct a new ByteClasses:: ByteClasses object with every byte in a
+ * single class
+ */
+ByteClasses::ByteClasses()
+{
+    this->m_classes.fill(0);
+    this->m_count = 1;
+}
+
+/**
+ * @brief
+ * Construct a new ByteClasses:: ByteClasses object where every symbol of
+ * the alphabet has its own class and every other byte shares one class
+ * @param alphabet Symbols of the expression
+ */
+ByteClasses::ByteClasses(const std::set<char> &alphabet)
+    : ByteClasses()
+{
+    for (const char &symbol : alphabet)
+        this->add_symbol(symbol);
+}
+
+/**
+ * @brief
+ * Construct a new ByteClasses:: ByteClasses object from the edges of a
+ * graph. For every vertex, the bytes leading to the same destination are
+ * kept together, so the classes are exact for a DFA.
+ * @param graph Graph whose edges are classified
+ */
+ByteClasses::ByteClasses(const Graph &graph)
+    : ByteClasses()
+{
+    std::map<int, std::bitset<BYTE_VALUES>> destinations;
+
+    for (int vertex = 0; vertex < graph.get_next(); vertex++)
+    {
+        destinations.clear();
+
+        for (const Transition &transition : graph.get_edges(vertex))
+            for (int byte = transition.low; byte <= transition.high; byte++)
+                destinations[transition.to].set(byte);
+
+        for (const auto &it : destinations)
+            this->add_set(it.second);
+    }
+}
+
+/**
+ * @brief
+ * Construct a new ByteClasses:: ByteClasses object from the class of every
+ * byte, as returned by get_classes
+ * @param classes Class of every byte
+ */
+ByteClasses::ByteClasses(const std::array<std::uint8_t, BYTE_VALUES> &classes)
+    : m_classes(classes)
+{
+    this->m_count = 0;
+
+    for (const std::uint8_t &class_id : this->m_classes)
+        this->m_count = std::max(this->m_count, class_id + 1);
+}
+
+// Access Methods
+/**
+ * @brief
+ * Get the number of classes
+ * @return int number of classes
+ */
+int ByteClasses::get_class_count() const
+{
+    return this->m_count;
+}
+
+/**
+ * @brief
+ * Get the class of every byte
+ * @return const std::array<std::uint8_t, BYTE_VALUES>& classes
+ */
+const std::array<std::uint8_t, BYTE_VALUES> &ByteClasses::get_classes() const
+{
+    return this->m_classes;
+}
+
+/**
+ * @brief
+ * Get the bytes of a class in increasing order
+ * @param class_id class to be listed
+ * @return std::vector<unsigned char> bytes of the class
+ */
+std::vector<unsigned char> ByteClasses::get_members(const int &class_id) const
+{
+    std::vector<unsigned char> members;
+
+    for (int byte = 0; byte < BYTE_VALUES; byte++)
+        if (this->m_classes[byte] == class_id)
+            members.push_back(static_cast<unsigned char>(byte));
+
+    return members;
+}
+
+/**
+ * @brief
+ * Get the smallest byte of every class. Every edge the classes were built
+ * from holds either all of a class or none of it, so an edge follows a
+ * class exactly when it holds its representative.
+ * @return std::vector<unsigned char> representative of every class
+ */
+std::vector<unsigned char> ByteClasses::get_representatives() const
+{
+    std::vector<unsigned char> representatives(this->m_count);
+    std::vector<bool> seen(this->m_count, false);
+
+    for (int byte = 0; byte < BYTE_VALUES; byte++)
+    {
+        int class_id = this->m_classes[byte];
+
+        if (!seen[class_id])
+        {
+            representatives[class_id] = static_cast<unsigned char>(byte);
+            seen[class_id] = true;
+        }
+    }
+
+    return representatives;
+}
+
+/**
+ * @brief
+ * Get the bytes of a class as maximal ranges of consecutive bytes
+ * @param class_id class to be listed
+ * @return std::vector<std::pair<unsigned char, unsigned char>> inclusive
+ * ranges in increasing order
+ */
+std::vector<std::pair<unsigned char, unsigned char>> ByteClasses::get_ranges(
+    const int &class_id) const
+{
+    std::vector<std::pair<unsigned char, unsigned char>> ranges;
+
+    for (int byte = 0; byte < BYTE_VALUES; byte++)
+    {
+        if (this->m_classes[byte] != class_id)
+            continue;
+
+        unsigned char value = static_cast<unsigned char>(byte);
+
+        if (!ranges.empty() && ranges.back().second + 1 == byte)
+            ranges.back().second = value;
+
+        else
+            ranges.push_back({value, value});
+    }
+
+    return ranges;
+}
+
+// Methods
+/**
+ * @brief
+ * Splits a symbol into its own class
+ * @param symbol symbol to be split
+ */
+void ByteClasses::add_symbol(const char &symbol)
+{
+    std::bitset<BYTE_VALUES> set;
+    set.set(static_cast<unsigned char>(symbol));
+
+    this->add_set(set);
+}
+
+/**
+ * @brief
+ * Refines the classes so that no class has bytes both inside and outside
+ * of a set. Classes are renumbered in order of their smallest byte.
+ * @param set set of bytes
+ */
+void ByteClasses::add_set(const std::bitset<BYTE_VALUES> &set)
+{
+    std::array<int, 2 * BYTE_VALUES> renumber;
+    renumber.fill(-1);
+
+    int count = 0;
+
+    for (int byte = 0; byte < BYTE_VALUES; byte++)
+    {
+        int key = 2 * this->m_classes[byte] + (set.test(byte) ? 1 : 0);
+
+        if (renumber[key] < 0)
+            renumber[key] = count++;
+
+        this->m_classes[byte] = static_cast<std::uint8_t>(renumber[key]);
+    }
+
+    this->m_count = count;
+}
@@ -0,0 +1,76 @@
+/**
+ * @file byte_classes.h
+ * @author Carlos Salguero
+ * @brief Declaration of the ByteClasses class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef BYTE_CLASSES_H
+#define BYTE_CLASSES_H
+
+// C++ Standard Library
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include <set>
+#include <utility>
+#include <vector>
+
+// Project files
+#include "../graph/graph.h"
+
+// Constants
+constexpr int BYTE_VALUES = 256;
+
+// Class
+/**
+ * @class ByteClasses
+ * @brief Partition of the 256 byte values into equivalence classes. Two
+ * bytes share a class when no edge of the automaton tells them apart, so
+ * tables can be indexed by class instead of by byte.
+ */
+class ByteClasses
+{
+public:
+    // Constructors
+    ByteClasses();
+    ByteClasses(const std::set<char> &);
+    ByteClasses(const Graph &);
+    ByteClasses(const std::array<std::uint8_t, BYTE_VALUES> &);
+
+    // Destructor
+    ~ByteClasses() = default;
+
+    // Access Methods
+    int get_class_count() const;
+    const std::array<std::uint8_t, BYTE_VALUES> &get_classes() const;
+    std::vector<unsigned char> get_members(const int &) const;
+    std::vector<unsigned char> get_representatives() const;
+    std::vector<std::pair<unsigned char, unsigned char>> get_ranges(
+        const int &) const;
+
+    /**
+     * @brief
+     * Get the class of a byte
+     * @param byte byte to be classified
+     * @return int class of the byte
+     */
+    int get_class(const unsigned char &byte) const
+    {
+        return this->m_classes[byte];
+    }
+
+    // Methods
+    void add_symbol(const char &);
+    void add_set(const std::bitset<BYTE_VALUES> &);
+
+private:
+    std::array<std::uint8_t, BYTE_VALUES> m_classes;
+    int m_count;
+};
+
+#endif //! BYTE_CLASSES_H
@@ -0,0 +1,258 @@
+/**
+ * @file literal_analyzer.cpp
+ * @author Carlos Salguero
+ * @brief Implementation of the LiteralAnalyzer class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+// C++ Standard Library
+#include <algorithm>
+#include <utility>
+
+// Project files
+#include "literal_analyzer.h"
+
+// Constructors
+/**
+ * @brief
+ * Construct a new LiteralAnalyzer:: LiteralAnalyzer object, analyzing the
+ * literals of an NFA with a single final vertex
+ * @param nfa NFA to be analyzed, as returned by Automata::build
+ */
+LiteralAnalyzer::LiteralAnalyzer(const Graph &nfa)
+{
+    if (nfa.get_final().size() != 1)
+        return;
+
+    const int final = *nfa.get_final().begin();
+    const std::vector<int> chain = dominator_chain(nfa, final);
+
+    if (chain.empty())
+        return;
+
+    std::string factor;
+    bool from_start = true;
+
+    for (std::size_t i = 0; i < chain.size(); i++)
+    {
+        const int vertex = chain[i];
+        const bool last = i + 1 == chain.size();
+
+        std::span<const Transition> edges = nfa.get_edges(vertex);
+        std::span<const int> epsilon = nfa.get_epsilon_edges(vertex);
+
+        // A single edge into the next dominator forces every path onward
+        if (!last && out_degree(nfa, vertex) == 1)
+        {
+            if (edges.size() == 1 && edges[0].to == chain[i + 1] &&
+                edges[0].low == edges[0].high)
+            {
+                factor += static_cast<char>(edges[0].low);
+                continue;
+            }
+
+            if (epsilon.size() == 1 && epsilon[0] == chain[i + 1])
+                continue;
+        }
+
+        if (from_start)
+            this->m_prefix = factor;
+
+        if (last && out_degree(nfa, vertex) == 0)
+            this->m_suffix = factor;
+
+        if (!factor.empty())
+            this->m_factors.push_back(factor);
+
+        factor.clear();
+        from_start = false;
+    }
+
+    for (const std::string &candidate : this->m_factors)
+        if (candidate.size() > this->m_required.size())
+            this->m_required = candidate;
+}
+
+// Access Methods
+/**
+ * @brief
+ * Get the literal every match starts with
+ * @return const std::string& prefix, empty if there is none
+ */
+const std::string &LiteralAnalyzer::get_prefix() const
+{
+    return this->m_prefix;
+}
+
+/**
+ * @brief
+ * Get the literal every match ends with
+ * @return const std::string& suffix, empty if there is none
+ */
+const std::string &LiteralAnalyzer::get_suffix() const
+{
+    return this->m_suffix;
+}
+
+/**
+ * @brief
+ * Get the longest literal every match contains
+ * @return const std::string& factor, empty if there is none
+ */
+const std::string &LiteralAnalyzer::get_required() const
+{
+    return this->m_required;
+}
+
+/**
+ * @brief
+ * Get every literal factor every match contains, in match order
+ * @return const std::vector<std::string>& factors
+ */
+const std::vector<std::string> &LiteralAnalyzer::get_factors() const
+{
+    return this->m_factors;
+}
+
+// Methods (private)
+/**
+ * @brief
+ * Computes the dominators of a vertex from the start vertex, with the
+ * iterative algorithm of Cooper, Harvey and Kennedy over reverse postorder
+ * @param nfa NFA to be analyzed
+ * @param target Vertex whose dominators are wanted
+ * @return std::vector<int> dominators from the start vertex to the target,
+ * empty if the target is unreachable
+ */
+std::vector<int> LiteralAnalyzer::dominator_chain(const Graph &nfa,
+                                                  const int &target)
+{
+    const int size = nfa.get_next();
+    const int start = nfa.get_start();
+
+    std::vector<int> order;
+    std::vector<int> position(size, -1);
+    std::vector<std::vector<int>> predecessors(size);
+
+    auto for_each_successor = [&](const int &vertex, auto &&f)
+    {
+        for (const Transition &transition : nfa.get_edges(vertex))
+            f(transition.to);
+
+        for (const int &destination : nfa.get_epsilon_edges(vertex))
+            f(destination);
+    };
+
+    // Iterative depth first search for the postorder
+    std::vector<bool> visited(size, false);
+    std::vector<std::pair<int, std::vector<int>>> stack;
+
+    visited[start] = true;
+    stack.push_back({start, {}});
+    for_each_successor(start, [&](int next)
+                       { stack.back().second.push_back(next); });
+
+    while (!stack.empty())
+    {
+        auto &[vertex, pending] = stack.back();
+
+        if (pending.empty())
+        {
+            order.push_back(vertex);
+            stack.pop_back();
+            continue;
+        }
+
+        int next = pending.back();
+        pending.pop_back();
+
+        predecessors[next].push_back(vertex);
+
+        if (visited[next])
+            continue;
+
+        visited[next] = true;
+        stack.push_back({next, {}});
+        for_each_successor(next, [&](int successor)
+                           { stack.back().second.push_back(successor); });
+    }
+
+    if (!visited[target])
+        return {};
+
+    std::reverse(order.begin(), order.end());
+
+    for (std::size_t i = 0; i < order.size(); i++)
+        position[order[i]] = static_cast<int>(i);
+
+    std::vector<int> dominator(size, -1);
+    dominator[start] = start;
+
+    auto intersect = [&](int left, int right)
+    {
+        while (left != right)
+        {
+            while (position[left] > position[right])
+                left = dominator[left];
+
+            while (position[right] > position[left])
+                right = dominator[right];
+        }
+
+        return left;
+    };
+
+    bool changed = true;
+
+    while (changed)
+    {
+        changed = false;
+
+        for (const int &vertex : order)
+        {
+            if (vertex == start)
+                continue;
+
+            int candidate = -1;
+
+            for (const int &predecessor : predecessors[vertex])
+                if (dominator[predecessor] >= 0)
+                    candidate = candidate < 0
+                                    ? predecessor
+                                    : intersect(predecessor, candidate);
+
+            if (candidate != dominator[vertex])
+            {
+                dominator[vertex] = candidate;
+                changed = true;
+            }
+        }
+    }
+
+    std::vector<int> chain;
+
+    for (int vertex = target; vertex != start; vertex = dominator[vertex])
+        chain.push_back(vertex);
+
+    chain.push_back(start);
+    std::reverse(chain.begin(), chain.end());
+
+    return chain;
+}
+
+/**
+ * @brief
+ * Counts the edges leaving a vertex, epsilon edges included
+ * @param nfa NFA to be analyzed
+ * @param vertex Vertex whose edges are counted
+ * @return int number of edges
+ */
+int LiteralAnalyzer::out_degree(const Graph &nfa, const int &vertex)
+{
+    return static_cast<int>(nfa.get_edges(vertex).size() +
+                            nfa.get_epsilon_edges(vertex).size());
+}
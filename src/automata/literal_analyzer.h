@@ -0,0 +1,60 @@
+/**
+ * @file literal_analyzer.h
+ * @author Carlos Salguero
+ * @brief Declaration of the LiteralAnalyzer class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef LITERAL_ANALYZER_H
+#define LITERAL_ANALYZER_H
+
+// C++ Standard Library
+#include <string>
+#include <vector>
+
+// Project files
+#include "../graph/graph.h"
+
+// Class
+/**
+ * @class LiteralAnalyzer
+ * @brief Finds the literals every match of an NFA must contain.
+ *
+ * The vertexes every accepting path goes through are the dominators of
+ * the final vertex. Along that chain, a dominator with a single edge
+ * forces every path into its successor, so a run of such dominators reads
+ * the same bytes on every accepting path: a required factor. A run from
+ * the start vertex is a prefix of every match and a run into a final
+ * vertex without edges is a suffix of every match.
+ */
+class LiteralAnalyzer
+{
+public:
+    // Constructors
+    LiteralAnalyzer(const Graph &);
+
+    // Destructor
+    ~LiteralAnalyzer() = default;
+
+    // Access Methods
+    const std::string &get_prefix() const;
+    const std::string &get_suffix() const;
+    const std::string &get_required() const;
+    const std::vector<std::string> &get_factors() const;
+
+private:
+    std::string m_prefix;
+    std::string m_suffix;
+    std::string m_required;
+    std::vector<std::string> m_factors;
+
+    // Methods
+    static std::vector<int> dominator_chain(const Graph &, const int &);
+    static int out_degree(const Graph &, const int &);
+};
+
+#endif //! LITERAL_ANALYZER_H
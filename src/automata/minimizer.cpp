@@ -0,0 +1,328 @@
+/**
+ * @file minimizer.cpp
+ * @author Carlos Salguero
+ * @brief Implementation of the Minimizer class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+// C++ Standard Library
+#include <algorithm>
+#include <map>
+
+// Project files
+#include "minimizer.h"
+#include "byte_classes.h"
+
+// Access Methods
+/**
+ * @brief
+ * Get the stats of the last minimization
+ * @return const MinimizerStats& stats
+ */
+const MinimizerStats &Minimizer::get_stats() const
+{
+    return this->m_stats;
+}
+
+// Methods (public)
+/**
+ * @brief
+ * Minimizes a DFA. Unreachable states are dropped, missing transitions go
+ * to an implicit dead state, and the states are refined with Hopcroft's
+ * algorithm starting from the partition of the states by the ids they
+ * accept (non final states apart).
+ * @param dfa DFA to be minimized, as returned by Automata::transform_dfa
+ * @return std::shared_ptr<Graph> minimal DFA accepting the same language
+ */
+std::shared_ptr<Graph> Minimizer::minimize(const Graph &dfa)
+{
+    const ByteClasses classes(dfa);
+    const int symbols = classes.get_class_count();
+
+    // Reachable states, numbered in breadth first order
+    std::vector<int> index(dfa.get_next(), -1);
+    std::vector<int> states;
+
+    index[dfa.get_start()] = 0;
+    states.push_back(dfa.get_start());
+
+    for (std::size_t i = 0; i < states.size(); i++)
+    {
+        for (const Transition &transition : dfa.get_edges(states[i]))
+        {
+            if (index[transition.to] >= 0)
+                continue;
+
+            index[transition.to] = static_cast<int>(states.size());
+            states.push_back(transition.to);
+        }
+    }
+
+    const int sink = static_cast<int>(states.size());
+    const int size = sink + 1;
+
+    // Complete transition function and its inverse, per class and target
+    std::vector<int> delta(static_cast<std::size_t>(size) * symbols, sink);
+
+    for (int state = 0; state < sink; state++)
+    {
+        for (const Transition &transition : dfa.get_edges(states[state]))
+        {
+            for (int byte = transition.low; byte <= transition.high; byte++)
+            {
+                int column = classes.get_class(static_cast<unsigned char>(byte));
+                delta[state * symbols + column] = index[transition.to];
+            }
+        }
+    }
+
+    std::vector<int> inverse_offsets(static_cast<std::size_t>(symbols) * size + 1,
+                                     0);
+    std::vector<int> inverse(static_cast<std::size_t>(symbols) * size);
+
+    for (int state = 0; state < size; state++)
+        for (int symbol = 0; symbol < symbols; symbol++)
+            inverse_offsets[symbol * size + delta[state * symbols + symbol] + 1]++;
+
+    for (std::size_t i = 1; i < inverse_offsets.size(); i++)
+        inverse_offsets[i] += inverse_offsets[i - 1];
+
+    {
+        std::vector<int> cursor(inverse_offsets.begin(), inverse_offsets.end() - 1);
+
+        for (int state = 0; state < size; state++)
+            for (int symbol = 0; symbol < symbols; symbol++)
+                inverse[cursor[symbol * size +
+                               delta[state * symbols + symbol]]++] = state;
+    }
+
+    // Initial partition
+    std::map<std::vector<int>, int> final_keys;
+    std::vector<int> keys(size, 0);
+
+    for (int state = 0; state < sink; state++)
+    {
+        if (!dfa.is_final(states[state]))
+            continue;
+
+        auto [it, inserted] = final_keys.try_emplace(
+            dfa.get_final_ids(states[state]),
+            static_cast<int>(final_keys.size()) + 1);
+        keys[state] = it->second;
+    }
+
+    this->m_elements.resize(size);
+    for (int state = 0; state < size; state++)
+        this->m_elements[state] = state;
+
+    std::stable_sort(this->m_elements.begin(), this->m_elements.end(),
+                     [&](int left, int right)
+                     { return keys[left] < keys[right]; });
+
+    this->m_location.assign(size, 0);
+    this->m_block_of.assign(size, 0);
+    this->m_first.clear();
+    this->m_past.clear();
+    this->m_marked.clear();
+
+    for (int i = 0; i < size; i++)
+    {
+        int state = this->m_elements[i];
+
+        if (i == 0 || keys[state] != keys[this->m_elements[i - 1]])
+        {
+            this->m_first.push_back(i);
+            this->m_past.push_back(i);
+            this->m_marked.push_back(0);
+        }
+
+        this->m_location[state] = i;
+        this->m_block_of[state] = static_cast<int>(this->m_first.size()) - 1;
+        this->m_past.back()++;
+    }
+
+    // Every initial block but the largest is a splitter for every class
+    std::vector<std::pair<int, int>> worklist;
+    std::vector<bool> pending(static_cast<std::size_t>(size) * symbols, false);
+
+    int largest = 0;
+    for (int block = 1; block < static_cast<int>(this->m_first.size()); block++)
+        if (this->m_past[block] - this->m_first[block] >
+            this->m_past[largest] - this->m_first[largest])
+            largest = block;
+
+    for (int block = 0; block < static_cast<int>(this->m_first.size()); block++)
+    {
+        if (block == largest)
+            continue;
+
+        for (int symbol = 0; symbol < symbols; symbol++)
+        {
+            worklist.push_back({block, symbol});
+            pending[block * symbols + symbol] = true;
+        }
+    }
+
+    // Refinement
+    std::vector<int> predecessors;
+    std::vector<int> touched;
+
+    while (!worklist.empty())
+    {
+        auto [splitter, symbol] = worklist.back();
+        worklist.pop_back();
+        pending[splitter * symbols + symbol] = false;
+
+        predecessors.clear();
+        for (int i = this->m_first[splitter]; i < this->m_past[splitter]; i++)
+        {
+            int target = this->m_elements[i];
+            int offset = symbol * size + target;
+
+            predecessors.insert(predecessors.end(),
+                                inverse.begin() + inverse_offsets[offset],
+                                inverse.begin() + inverse_offsets[offset + 1]);
+        }
+
+        touched.clear();
+        for (const int &state : predecessors)
+            this->mark(state, touched);
+
+        for (const int &block : touched)
+        {
+            if (this->m_marked[block] ==
+                this->m_past[block] - this->m_first[block])
+            {
+                this->m_marked[block] = 0;
+                continue;
+            }
+
+            int created = this->split(block);
+            int smaller = this->m_past[block] - this->m_first[block] <=
+                                  this->m_past[created] - this->m_first[created]
+                              ? block
+                              : created;
+
+            for (int other = 0; other < symbols; other++)
+            {
+                int added = pending[block * symbols + other] ? created : smaller;
+
+                if (pending[added * symbols + other])
+                    continue;
+
+                worklist.push_back({added, other});
+                pending[added * symbols + other] = true;
+            }
+        }
+    }
+
+    // Quotient automaton, without the dead block
+    const int dead = this->m_block_of[sink];
+
+    std::vector<int> block_vertex(this->m_first.size(), -1);
+    std::vector<int> order;
+
+    std::shared_ptr<Graph> minimal = std::make_shared<Graph>();
+
+    int start_block = this->m_block_of[0];
+    block_vertex[start_block] = minimal->create_vertex();
+    minimal->set_start(block_vertex[start_block]);
+    order.push_back(start_block);
+
+    for (std::size_t i = 0; i < order.size() && start_block != dead; i++)
+    {
+        int block = order[i];
+        int representative = this->m_elements[this->m_first[block]];
+
+        if (dfa.is_final(states[representative]))
+        {
+            minimal->add_final(block_vertex[block]);
+
+            for (const int &id : dfa.get_final_ids(states[representative]))
+                minimal->add_final(block_vertex[block], id);
+        }
+
+        for (const Transition &transition :
+             dfa.get_edges(states[representative]))
+        {
+            int target = this->m_block_of[index[transition.to]];
+
+            if (target == dead)
+                continue;
+
+            if (block_vertex[target] < 0)
+            {
+                block_vertex[target] = minimal->create_vertex();
+                order.push_back(target);
+            }
+
+            minimal->add_edge(block_vertex[block], transition.low,
+                              transition.high, block_vertex[target]);
+        }
+    }
+
+    minimal->freeze();
+
+    this->m_stats.states_before = dfa.get_next();
+    this->m_stats.states_unreachable = dfa.get_next() - sink;
+    this->m_stats.states_after = minimal->get_next();
+    this->m_stats.states_removed =
+        this->m_stats.states_before - this->m_stats.states_after;
+
+    return minimal;
+}
+
+// Methods (private)
+/**
+ * @brief
+ * Marks a state, moving it to the marked prefix of its block
+ * @param state state to be marked
+ * @param touched blocks with at least one marked state
+ */
+void Minimizer::mark(const int &state, std::vector<int> &touched)
+{
+    int block = this->m_block_of[state];
+    int boundary = this->m_first[block] + this->m_marked[block];
+    int location = this->m_location[state];
+
+    if (location < boundary)
+        return;
+
+    int other = this->m_elements[boundary];
+
+    std::swap(this->m_elements[location], this->m_elements[boundary]);
+    this->m_location[other] = location;
+    this->m_location[state] = boundary;
+
+    if (this->m_marked[block] == 0)
+        touched.push_back(block);
+
+    this->m_marked[block]++;
+}
+
+/**
+ * @brief
+ * Splits the marked prefix of a block into a new block
+ * @param block block to be split
+ * @return int new block holding the marked states
+ */
+int Minimizer::split(const int &block)
+{
+    int created = static_cast<int>(this->m_first.size());
+
+    this->m_first.push_back(this->m_first[block]);
+    this->m_past.push_back(this->m_first[block] + this->m_marked[block]);
+    this->m_marked.push_back(0);
+
+    this->m_first[block] += this->m_marked[block];
+    this->m_marked[block] = 0;
+
+    for (int i = this->m_first[created]; i < this->m_past[created]; i++)
+        this->m_block_of[this->m_elements[i]] = created;
+
+    return created;
+}
@@ -0,0 +1,72 @@
+/**
+ * @file minimizer.h
+ * @author Carlos Salguero
+ * @brief Declaration of the Minimizer class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef MINIMIZER_H
+#define MINIMIZER_H
+
+// C++ Standard Library
+#include <memory>
+#include <vector>
+
+// Project files
+#include "../graph/graph.h"
+
+// Structs
+/**
+ * @struct MinimizerStats
+ * @brief Size of the DFA before and after the last minimization
+ */
+struct MinimizerStats
+{
+    int states_before = 0;
+    int states_after = 0;
+    int states_unreachable = 0;
+    int states_removed = 0;
+};
+
+// Class
+/**
+ * @class Minimizer
+ * @brief Hopcroft partition refinement, O(n log n) in the number of
+ * states, over the byte classes of the DFA
+ */
+class Minimizer
+{
+public:
+    // Constructors
+    Minimizer() = default;
+
+    // Destructor
+    ~Minimizer() = default;
+
+    // Access Methods
+    const MinimizerStats &get_stats() const;
+
+    // Methods
+    std::shared_ptr<Graph> minimize(const Graph &);
+
+private:
+    MinimizerStats m_stats;
+
+    // Partition of the states
+    std::vector<int> m_elements;
+    std::vector<int> m_location;
+    std::vector<int> m_block_of;
+    std::vector<int> m_first;
+    std::vector<int> m_past;
+    std::vector<int> m_marked;
+
+    // Methods
+    void mark(const int &, std::vector<int> &);
+    int split(const int &);
+};
+
+#endif //! MINIMIZER_H
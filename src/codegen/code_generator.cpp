@@ -0,0 +1,189 @@
+/**
+ * @file code_generator.cpp
+ * @author Carlos Salguero
+ * @brief Implementation of the CodeGenerator class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+// C++ Standard Library
+#include <array>
+#include <cctype>
+#include <cstdio>
+#include <map>
+#include <stdexcept>
+#include <vector>
+
+// Project files
+#include "code_generator.h"
+#include "../automata/byte_classes.h"
+
+// Constants
+constexpr int DEAD_STATE = -1;
+
+// Constructors
+/**
+ * @brief
+ * Construct a new CodeGenerator:: CodeGenerator object
+ * @param dfa DFA to be emitted, as returned by Automata::transform_dfa or
+ * Minimizer::minimize. It must outlive the generator.
+ */
+CodeGenerator::CodeGenerator(const Graph &dfa)
+    : m_dfa(dfa)
+{
+}
+
+// Methods (public)
+/**
+ * @brief
+ * Emits a function bool name(std::string_view) noexcept that checks if
+ * the whole input is accepted by the DFA
+ * @param name Name of the function
+ * @param expression Source expression, quoted in a comment
+ * @return std::string C++ source of the function
+ * @throws std::invalid_argument if the name is not a C++ identifier
+ */
+std::string CodeGenerator::generate(const std::string &name,
+                                    const std::string &expression) const
+{
+    if (!is_identifier(name))
+        throw std::invalid_argument("not a C++ identifier: " + name);
+
+    std::ostringstream source;
+
+    source << "// Generated by regex-to-cpp";
+
+    if (!expression.empty())
+    {
+        source << " from the expression\n// ";
+
+        for (const char &character : expression)
+            source << (character == '\n' ? ' ' : character);
+    }
+
+    source << "\n\n"
+           << "#include <string_view>\n\n"
+           << "bool " << name << "(std::string_view input) noexcept\n"
+           << "{\n"
+           << "    const unsigned char *position =\n"
+           << "        reinterpret_cast<const unsigned char *>(input.data());\n"
+           << "    const unsigned char *const end = position + input.size();\n"
+           << "\n"
+           << "    goto state_" << this->m_dfa.get_start() << ";\n";
+
+    for (int state = 0; state < this->m_dfa.get_next(); state++)
+        this->emit_state(source, state);
+
+    source << "}\n";
+
+    return source.str();
+}
+
+// Methods (private)
+/**
+ * @brief
+ * Emits the label and the switch of one state. The most common target,
+ * which may be the dead state, becomes the default case.
+ * @param source Source being emitted
+ * @param state DFA state
+ */
+void CodeGenerator::emit_state(std::ostringstream &source,
+                               const int &state) const
+{
+    const bool final = this->m_dfa.is_final(state);
+
+    std::array<int, BYTE_VALUES> targets;
+    targets.fill(DEAD_STATE);
+
+    for (const Transition &transition : this->m_dfa.get_edges(state))
+        for (int byte = transition.low; byte <= transition.high; byte++)
+            targets[byte] = transition.to;
+
+    source << "\nstate_" << state << ":\n"
+           << "    if (position == end)\n"
+           << "        return " << (final ? "true" : "false") << ";\n";
+
+    if (this->m_dfa.get_edges(state).empty())
+    {
+        source << "    return false;\n";
+        return;
+    }
+
+    std::map<int, std::vector<int>> bytes;
+
+    for (int byte = 0; byte < BYTE_VALUES; byte++)
+        bytes[targets[byte]].push_back(byte);
+
+    int fallback = bytes.begin()->first;
+
+    for (const auto &[target, members] : bytes)
+        if (members.size() > bytes[fallback].size())
+            fallback = target;
+
+    auto jump = [&](const int &target)
+    {
+        if (target == DEAD_STATE)
+            return std::string("return false;");
+
+        return "goto state_" + std::to_string(target) + ";";
+    };
+
+    source << "\n"
+           << "    switch (*position++)\n"
+           << "    {\n";
+
+    for (const auto &[target, members] : bytes)
+    {
+        if (target == fallback)
+            continue;
+
+        for (const int &byte : members)
+            source << "    case " << byte_literal(byte) << ":\n";
+
+        source << "        " << jump(target) << "\n";
+    }
+
+    source << "    default:\n"
+           << "        " << jump(fallback) << "\n"
+           << "    }\n";
+}
+
+/**
+ * @brief
+ * Writes a byte as a case label, as a character literal when it is
+ * printable
+ * @param byte Byte to be written
+ * @return std::string C++ literal of the byte
+ */
+std::string CodeGenerator::byte_literal(const unsigned char &byte)
+{
+    if (std::isalnum(byte))
+        return std::string("'") + static_cast<char>(byte) + "'";
+
+    char literal[8];
+    std::snprintf(literal, sizeof(literal), "0x%02x", byte);
+
+    return literal;
+}
+
+/**
+ * @brief
+ * Checks if a name is a valid C++ identifier
+ * @param name Name to be checked
+ * @return true if the name is an identifier
+ */
+bool CodeGenerator::is_identifier(const std::string &name)
+{
+    if (name.empty() || std::isdigit(static_cast<unsigned char>(name[0])))
+        return false;
+
+    for (const char &character : name)
+        if (!std::isalnum(static_cast<unsigned char>(character)) &&
+            character != '_')
+            return false;
+
+    return true;
+}
@@ -0,0 +1,51 @@
+/**
+ * @file code_generator.h
+ * @author Carlos Salguero
+ * @brief Declaration of the CodeGenerator class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef CODE_GENERATOR_H
+#define CODE_GENERATOR_H
+
+// C++ Standard Library
+#include <sstream>
+#include <string>
+
+// Project files
+#include "../graph/graph.h"
+
+// Class
+/**
+ * @class CodeGenerator
+ * @brief Emits a DFA as standalone C++ source. Every state becomes a label
+ * and a switch on the next byte, whose cases jump straight to the next
+ * state, so no transition table is loaded while matching.
+ */
+class CodeGenerator
+{
+public:
+    // Constructors
+    CodeGenerator(const Graph &);
+
+    // Destructor
+    ~CodeGenerator() = default;
+
+    // Methods
+    std::string generate(const std::string &,
+                         const std::string &expression = "") const;
+
+private:
+    const Graph &m_dfa;
+
+    // Methods
+    void emit_state(std::ostringstream &, const int &) const;
+    static std::string byte_literal(const unsigned char &);
+    static bool is_identifier(const std::string &);
+};
+
+#endif //! CODE_GENERATOR_H
@@ -0,0 +1,91 @@
+/**
+ * @file codegen_main.cpp
+ * @author Carlos Salguero
+ * @brief Declaration of the main function of regex-to-cpp, which prints a
+ * pattern as a C++ matcher function
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+// C++ Standard Library
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+// Project files
+#include "code_generator.h"
+#include "../automata/automata.h"
+#include "../automata/minimizer.h"
+
+int main(int argc, char **argv)
+{
+    std::string name = "match";
+    std::string pattern;
+    bool has_pattern = false;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (std::strcmp(argv[i], "-n") == 0 && i + 1 < argc)
+            name = argv[++i];
+
+        else if (std::strcmp(argv[i], "-f") == 0 && i + 1 < argc &&
+                 !has_pattern)
+        {
+            std::ifstream file(argv[++i]);
+
+            if (!file || !std::getline(file, pattern))
+            {
+                std::cerr << argv[0] << ": cannot read a pattern from "
+                          << argv[i] << std::endl;
+                return 2;
+            }
+
+            has_pattern = true;
+        }
+
+        else if (argv[i][0] != '-' && !has_pattern)
+        {
+            pattern = argv[i];
+            has_pattern = true;
+        }
+
+        else
+        {
+            has_pattern = false;
+            break;
+        }
+    }
+
+    if (!has_pattern)
+    {
+        std::cerr << "usage: " << argv[0]
+                  << " [-n function_name] (-f pattern_file | pattern)\n"
+                  << "  Prints a C++ function matching the whole input\n"
+                  << "  against the minimal DFA of the pattern.\n";
+        return 2;
+    }
+
+    try
+    {
+        Automata automata(pattern);
+        Minimizer minimizer;
+
+        std::shared_ptr<Graph> dfa =
+            minimizer.minimize(*automata.transform_dfa());
+
+        std::cout << CodeGenerator(*dfa).generate(name, pattern);
+    }
+
+    catch (const std::exception &error)
+    {
+        std::cerr << argv[0] << ": " << error.what() << std::endl;
+        return 2;
+    }
+
+    return 0;
+}
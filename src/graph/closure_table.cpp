@@ -0,0 +1,218 @@
+/**
+ * @file closure_table.cpp
+ * @author Carlos Salguero
+ * @brief Implementation of the ClosureTable class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+// C++ Standard Library
+#include <algorithm>
+#include <utility>
+
+// Project file
+#include "closure_table.h"
+
+// Constructors
+/**
+ * @brief
+ * Construct a new ClosureTable:: ClosureTable object. The components are
+ * found with an iterative Tarjan traversal of the epsilon edges, which
+ * emits every component after the components it reaches, so each closure
+ * is the union of its members and of already computed closures. The words
+ * of a closure span from its smallest to its largest vertex, found from
+ * the members and the spans of the closures it reaches before any word is
+ * written.
+ * @param graph Graph whose closures are computed
+ */
+ClosureTable::ClosureTable(const Graph &graph)
+{
+    const int vertexes = graph.get_next();
+
+    std::vector<int> index(vertexes, -1);
+    std::vector<int> low(vertexes, 0);
+    std::vector<bool> on_stack(vertexes, false);
+    std::vector<int> stack;
+    std::vector<std::pair<int, std::size_t>> calls;
+    std::vector<int> stamp(vertexes, -1);
+    std::vector<int> members;
+    std::vector<int> reached;
+    int counter = 0;
+
+    this->m_component.assign(vertexes, -1);
+    this->m_first_word.clear();
+    this->m_offsets.assign(1, 0);
+    this->m_words.clear();
+
+    auto emit = [&](const int &root)
+    {
+        const int component = static_cast<int>(this->m_first_word.size());
+
+        members.clear();
+        reached.clear();
+
+        int vertex;
+        do
+        {
+            vertex = stack.back();
+            stack.pop_back();
+            on_stack[vertex] = false;
+
+            this->m_component[vertex] = component;
+            members.push_back(vertex);
+        } while (vertex != root);
+
+        int first = vertexes;
+        int last = 0;
+
+        for (const int &member : members)
+        {
+            first = std::min(first, member >> 6);
+            last = std::max(last, member >> 6);
+
+            for (const int &destination : graph.get_epsilon_edges(member))
+            {
+                int other = this->m_component[destination];
+
+                if (other == component || stamp[other] == component)
+                    continue;
+
+                stamp[other] = component;
+                reached.push_back(other);
+
+                first = std::min(first, this->m_first_word[other]);
+                last = std::max(
+                    last, this->m_first_word[other] +
+                              static_cast<int>(this->m_offsets[other + 1] -
+                                               this->m_offsets[other]) -
+                              1);
+            }
+        }
+
+        const std::size_t begin = this->m_words.size();
+        this->m_words.resize(begin + last - first + 1, 0);
+
+        for (const int &member : members)
+            this->m_words[begin + (member >> 6) - first] |=
+                std::uint64_t(1) << (member & 63);
+
+        for (const int &other : reached)
+        {
+            const std::size_t shift =
+                begin + this->m_first_word[other] - first;
+
+            for (std::size_t i = this->m_offsets[other];
+                 i < this->m_offsets[other + 1]; i++)
+                this->m_words[shift + i - this->m_offsets[other]] |=
+                    this->m_words[i];
+        }
+
+        this->m_first_word.push_back(first);
+        this->m_offsets.push_back(this->m_words.size());
+    };
+
+    for (int root = 0; root < vertexes; root++)
+    {
+        if (index[root] >= 0)
+            continue;
+
+        calls.push_back({root, 0});
+        index[root] = low[root] = counter++;
+        stack.push_back(root);
+        on_stack[root] = true;
+
+        while (!calls.empty())
+        {
+            auto &[vertex, edge] = calls.back();
+            std::span<const int> edges = graph.get_epsilon_edges(vertex);
+
+            if (edge < edges.size())
+            {
+                int destination = edges[edge++];
+
+                if (index[destination] < 0)
+                {
+                    index[destination] = low[destination] = counter++;
+                    stack.push_back(destination);
+                    on_stack[destination] = true;
+                    calls.push_back({destination, 0});
+                }
+
+                else if (on_stack[destination])
+                    low[vertex] = std::min(low[vertex], index[destination]);
+
+                continue;
+            }
+
+            int finished = vertex;
+            calls.pop_back();
+
+            if (low[finished] == index[finished])
+                emit(finished);
+
+            if (!calls.empty())
+            {
+                int parent = calls.back().first;
+                low[parent] = std::min(low[parent], low[finished]);
+            }
+        }
+    }
+
+    this->m_words.shrink_to_fit();
+}
+
+// Access Methods
+/**
+ * @brief
+ * Get the number of strongly connected components of the epsilon edges
+ * @return int number of components
+ */
+int ClosureTable::get_component_count() const
+{
+    return static_cast<int>(this->m_first_word.size());
+}
+
+/**
+ * @brief
+ * Get the memory used by the table
+ * @return std::size_t size in bytes
+ */
+std::size_t ClosureTable::get_memory_usage() const
+{
+    return (this->m_component.size() + this->m_first_word.size()) *
+               sizeof(int) +
+           this->m_offsets.size() * sizeof(std::size_t) +
+           this->m_words.size() * sizeof(std::uint64_t);
+}
+
+// Methods
+/**
+ * @brief
+ * Computes the epsilon closure of a set of vertexes without allocating.
+ * A vertex already in the result is skipped, since its closure is part of
+ * the closure that added it, and every other closure is ORed in word by
+ * word.
+ * @param vertexes vertexes whose closure is computed
+ * @param closure result, cleared first; must not alias vertexes
+ */
+void ClosureTable::close(const StateSet &vertexes, StateSet &closure) const
+{
+    closure.clear();
+
+    vertexes.for_each([&](int vertex)
+                      {
+        if (vertex >= static_cast<int>(this->m_component.size()) ||
+            closure.contains(vertex))
+            return;
+
+        const int component = this->m_component[vertex];
+
+        closure.unite(this->m_first_word[component],
+                      std::span<const std::uint64_t>(
+                          this->m_words.data() + this->m_offsets[component],
+                          this->m_offsets[component + 1] -
+                              this->m_offsets[component])); });
+}
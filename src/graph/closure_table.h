@@ -0,0 +1,91 @@
+/**
+ * @file closure_table.h
+ * @author Carlos Salguero
+ * @brief Declaration of the ClosureTable class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef CLOSURE_TABLE_H
+#define CLOSURE_TABLE_H
+
+// C++ Standard Library
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+// Project files
+#include "graph.h"
+#include "state_set.h"
+
+// Class
+/**
+ * @class ClosureTable
+ * @brief Epsilon closure of every vertex of a graph, computed once.
+ *
+ * Vertexes of the same strongly connected component of the epsilon
+ * subgraph share one closure, built from the closures of the components it
+ * reaches. A closure is stored as the words of a bitset between its
+ * smallest and its largest vertex, so closing a set ORs whole words. A
+ * closure spanning n vertexes takes n / 64 words, and a chain of n epsilon
+ * edges still takes about n * n / 128 words in total.
+ */
+class ClosureTable
+{
+public:
+    // Constructors
+    ClosureTable() = default;
+    ClosureTable(const Graph &);
+
+    // Destructor
+    ~ClosureTable() = default;
+
+    // Access Methods
+    int get_component_count() const;
+    std::size_t get_memory_usage() const;
+
+    // Methods
+    void close(const StateSet &, StateSet &) const;
+
+    /**
+     * @brief
+     * Calls a function for every vertex of the epsilon closure of a vertex,
+     * in increasing order
+     * @param vertex vertex whose closure is walked
+     * @param function function receiving each vertex of the closure
+     */
+    template <typename Function>
+    void for_each(const int &vertex, Function function) const
+    {
+        const int component = this->m_component[vertex];
+        const std::size_t begin = this->m_offsets[component];
+        const std::size_t end = this->m_offsets[component + 1];
+
+        for (std::size_t i = begin; i < end; i++)
+        {
+            std::uint64_t word = this->m_words[i];
+            const int base =
+                (this->m_first_word[component] + static_cast<int>(i - begin)) *
+                64;
+
+            while (word != 0)
+            {
+                function(base + std::countr_zero(word));
+                word &= word - 1;
+            }
+        }
+    }
+
+private:
+    std::vector<int> m_component;
+    std::vector<int> m_first_word;
+    std::vector<std::size_t> m_offsets;
+    std::vector<std::uint64_t> m_words;
+};
+
+#endif //! CLOSURE_TABLE_H
@@ -9,6 +9,7 @@
  *
  */
 // C++ Standard Libraries
+#include <algorithm>
 #include <stack>
 #include <sstream>
 
@@ -22,7 +23,9 @@
  */
 Graph::Graph()
 {
+    this->m_start = 0;
     this->m_next = 0;
+    this->m_frozen = false;
 }
 
 /**
@@ -35,42 +38,100 @@ Graph::Graph(const Graph &other)
     this->m_start = other.m_start;
     this->m_next = other.m_next;
     this->m_final = other.m_final;
-    this->m_vertexes = other.m_vertexes;
-    this->m_edges = other.m_edges;
+    this->m_final_ids = other.m_final_ids;
+    this->m_known_vertexes = other.m_known_vertexes;
+    this->m_builder_edges = other.m_builder_edges;
+    this->m_builder_epsilon = other.m_builder_epsilon;
+    this->m_frozen = other.m_frozen;
+    this->m_offsets = other.m_offsets;
+    this->m_transitions = other.m_transitions;
+    this->m_epsilon_offsets = other.m_epsilon_offsets;
+    this->m_epsilon_targets = other.m_epsilon_targets;
 }
 
-// Access Methods
 /**
  * @brief
- * Get the weight of an edge
- * @param from Origin vertex
- * @param to Destination vertex
- * @return const weight of the edge
- * @return const std::optional<char> no_weight if the edge does not exist
+ * Construct a new Graph:: Graph object directly in the frozen form from a
+ * list of edges, without going through the builder form
+ * @param vertexes number of vertexes, every edge must be within it
+ * @param edges edges of the graph
  */
-const std::optional<char> &Graph::get_weight(
-    const int &from, const int &to) const
+Graph::Graph(const int &vertexes, const std::vector<Edge> &edges)
 {
-    auto it = this->m_edges.find(from);
+    this->m_start = 0;
+    this->m_next = vertexes;
+    this->m_frozen = true;
+    this->m_known_vertexes.assign(vertexes, false);
+
+    this->m_offsets.assign(vertexes + 1, 0);
+    this->m_epsilon_offsets.assign(vertexes + 1, 0);
 
-    if (it != this->m_edges.end())
+    for (const Edge &edge : edges)
     {
-        const std::map<char, std::set<int>> &edges_map = it->second;
+        this->m_known_vertexes[edge.from] = true;
+        this->m_known_vertexes[edge.to] = true;
 
-        for (const auto &weight_it : edges_map)
-        {
-            const std::set<int> &destinations = weight_it.second;
+        if (edge.epsilon)
+            this->m_epsilon_offsets[edge.from + 1]++;
 
-            if (destinations.count(to) > 0)
-            {
-                static const std::optional<char> weight(weight_it.first);
-                return weight;
-            }
-        }
+        else
+            this->m_offsets[edge.from + 1]++;
+    }
+
+    for (int vertex = 0; vertex < vertexes; vertex++)
+    {
+        this->m_offsets[vertex + 1] += this->m_offsets[vertex];
+        this->m_epsilon_offsets[vertex + 1] += this->m_epsilon_offsets[vertex];
     }
 
-    static const std::optional<char> no_weight;
-    return no_weight;
+    this->m_transitions.resize(this->m_offsets[vertexes]);
+    this->m_epsilon_targets.resize(this->m_epsilon_offsets[vertexes]);
+
+    std::vector<int> cursor(this->m_offsets.begin(), this->m_offsets.end() - 1);
+    std::vector<int> epsilon_cursor(this->m_epsilon_offsets.begin(),
+                                    this->m_epsilon_offsets.end() - 1);
+
+    for (const Edge &edge : edges)
+    {
+        if (edge.epsilon)
+            this->m_epsilon_targets[epsilon_cursor[edge.from]++] = edge.to;
+
+        else
+            this->m_transitions[cursor[edge.from]++] = {edge.low, edge.high,
+                                                        edge.to};
+    }
+
+    for (int vertex = 0; vertex < vertexes; vertex++)
+    {
+        std::sort(this->m_transitions.begin() + this->m_offsets[vertex],
+                  this->m_transitions.begin() + this->m_offsets[vertex + 1]);
+        std::sort(this->m_epsilon_targets.begin() +
+                      this->m_epsilon_offsets[vertex],
+                  this->m_epsilon_targets.begin() +
+                      this->m_epsilon_offsets[vertex + 1]);
+    }
+}
+
+// Access Methods
+/**
+ * @brief
+ * Get the weight of an edge
+ * @param from Origin vertex
+ * @param to Destination vertex
+ * @return std::optional<char> weight of the edge, the smallest byte of its
+ * range, empty if the edge does not exist
+ */
+std::optional<char> Graph::get_weight(const int &from, const int &to) const
+{
+    for (const Transition &transition : this->get_edges(from))
+        if (transition.to == to)
+            return static_cast<char>(transition.low);
+
+    for (const int &destination : this->get_epsilon_edges(from))
+        if (destination == to)
+            return EPSILON;
+
+    return std::nullopt;
 }
 
 /**
@@ -105,22 +166,139 @@ const std::set<int> &Graph::get_final() const
 
 /**
  * @brief
- * Get the vertexes
- * @return const std::set<int>& vertexes
+ * Get the ids carried by a final vertex, sorted
+ * @param final final vertex
+ * @return const std::vector<int>& ids, empty if the vertex carries none
  */
-const std::set<int> &Graph::get_vertexes() const
+const std::vector<int> &Graph::get_final_ids(const int &final) const
 {
-    return this->m_vertexes;
+    static const std::vector<int> no_ids;
+
+    auto it = this->m_final_ids.find(final);
+    return it != this->m_final_ids.end() ? it->second : no_ids;
 }
 
 /**
  * @brief
- * Get the edges
- * @return const std::map<int, std::map<char, std::set<int>>>& edges
+ * Get the vertexes that have at least one edge
+ * @return std::set<int> vertexes
  */
-const std::map<int, std::map<char, std::set<int>>> &Graph::get_edges() const
+std::set<int> Graph::get_vertexes() const
 {
-    return this->m_edges;
+    std::set<int> vertexes;
+
+    for (int vertex = 0; vertex < static_cast<int>(this->m_known_vertexes.size());
+         vertex++)
+        if (this->m_known_vertexes[vertex])
+            vertexes.insert(vertexes.end(), vertex);
+
+    return vertexes;
+}
+
+/**
+ * @brief
+ * Get the symbol edges leaving a vertex. Once the graph is frozen they are
+ * sorted by range and destination, and contiguous in memory.
+ * @param vertex Origin vertex
+ * @return std::span<const Transition> edges leaving the vertex
+ */
+std::span<const Transition> Graph::get_edges(const int &vertex) const
+{
+    if (this->m_frozen)
+    {
+        if (vertex < 0 || vertex + 1 >= static_cast<int>(this->m_offsets.size()))
+            return {};
+
+        return std::span<const Transition>(
+            this->m_transitions.data() + this->m_offsets[vertex],
+            this->m_offsets[vertex + 1] - this->m_offsets[vertex]);
+    }
+
+    if (vertex < 0 || vertex >= static_cast<int>(this->m_builder_edges.size()))
+        return {};
+
+    return this->m_builder_edges[vertex];
+}
+
+/**
+ * @brief
+ * Get the destinations of the epsilon edges leaving a vertex
+ * @param vertex Origin vertex
+ * @return std::span<const int> destinations of the epsilon edges
+ */
+std::span<const int> Graph::get_epsilon_edges(const int &vertex) const
+{
+    if (this->m_frozen)
+    {
+        if (vertex < 0 ||
+            vertex + 1 >= static_cast<int>(this->m_epsilon_offsets.size()))
+            return {};
+
+        return std::span<const int>(
+            this->m_epsilon_targets.data() + this->m_epsilon_offsets[vertex],
+            this->m_epsilon_offsets[vertex + 1] -
+                this->m_epsilon_offsets[vertex]);
+    }
+
+    if (vertex < 0 ||
+        vertex >= static_cast<int>(this->m_builder_epsilon.size()))
+        return {};
+
+    return this->m_builder_epsilon[vertex];
+}
+
+/**
+ * @brief
+ * Get the number of edges, epsilon edges included
+ * @return std::size_t number of edges
+ */
+std::size_t Graph::get_edge_count() const
+{
+    if (this->m_frozen)
+        return this->m_transitions.size() + this->m_epsilon_targets.size();
+
+    std::size_t count = 0;
+
+    for (const std::vector<Transition> &edges : this->m_builder_edges)
+        count += edges.size();
+
+    for (const std::vector<int> &edges : this->m_builder_epsilon)
+        count += edges.size();
+
+    return count;
+}
+
+/**
+ * @brief
+ * Get an estimate of the memory used by the graph
+ * @return std::size_t size in bytes, counting edges and vertexes but not
+ * the bookkeeping of the allocator
+ */
+std::size_t Graph::get_memory_usage() const
+{
+    std::size_t usage = sizeof(Graph) + this->m_known_vertexes.size() / 8 +
+                        this->m_final.size() * 4 * sizeof(int);
+
+    for (const auto &[vertex, ids] : this->m_final_ids)
+        usage += (ids.size() + 4) * sizeof(int);
+
+    if (this->m_frozen)
+        return usage +
+               (this->m_offsets.size() + this->m_epsilon_offsets.size() +
+                this->m_epsilon_targets.size()) *
+                   sizeof(int) +
+               this->m_transitions.size() * sizeof(Transition);
+
+    usage += this->m_builder_edges.size() * sizeof(std::vector<Transition>) +
+             this->m_builder_epsilon.size() * sizeof(std::vector<int>);
+
+    for (const std::vector<Transition> &edges : this->m_builder_edges)
+        usage += edges.size() * sizeof(Transition);
+
+    for (const std::vector<int> &edges : this->m_builder_epsilon)
+        usage += edges.size() * sizeof(int);
+
+    return usage;
 }
 
 // Mutator Methods
@@ -154,6 +332,23 @@ void Graph::add_final(const std::set<int> &final)
     this->m_final.insert(final.begin(), final.end());
 }
 
+/**
+ * @brief
+ * Adds a final vertex carrying an id, such as the pattern it accepts
+ * @param final final vertex
+ * @param id id reported when the vertex is reached
+ */
+void Graph::add_final(const int &final, const int &id)
+{
+    this->m_final.insert(final);
+
+    std::vector<int> &ids = this->m_final_ids[final];
+    auto it = std::lower_bound(ids.begin(), ids.end(), id);
+
+    if (it == ids.end() || *it != id)
+        ids.insert(it, id);
+}
+
 // Methods (Public)
 /**
  * @brief
@@ -163,22 +358,8 @@ void Graph::add_final(const std::set<int> &final)
  */
 bool Graph::is_empty() const
 {
-    auto it = this->m_edges.find(this->m_start);
-
-    if (it != this->m_edges.end())
-    {
-        const std::map<char, std::set<int>> &edges_map = it->second;
-
-        for (const auto &weight_it : edges_map)
-        {
-            const std::set<int> &destinations = weight_it.second;
-
-            if (!destinations.empty())
-                return false;
-        }
-    }
-
-    return true;
+    return this->get_edges(this->m_start).empty() &&
+           this->get_epsilon_edges(this->m_start).empty();
 }
 
 /**
@@ -202,52 +383,120 @@ bool Graph::is_final(const int &value) const
  */
 bool Graph::contains_vertex(const int &vertex) const
 {
-    return this->m_vertexes.count(vertex) > 0;
+    return vertex >= 0 &&
+           vertex < static_cast<int>(this->m_known_vertexes.size()) &&
+           this->m_known_vertexes[vertex];
+}
+
+/**
+ * @brief
+ * Checks if the edges are in the compressed (frozen) form
+ * @return true if the graph is frozen
+ */
+bool Graph::is_frozen() const
+{
+    return this->m_frozen;
 }
 
 /**
  * @brief
- * Adds an edge to the graph
+ * Adds an edge to the graph. Adding an edge to a frozen graph brings it
+ * back to the builder form.
  * @param from Origin vertex
- * @param value Value of the edge
+ * @param value Value of the edge, EPSILON for an epsilon edge
  * @param to Destination vertex
  */
 void Graph::add_edge(const int &from, const char &value, const int &to)
 {
-    this->m_vertexes.insert(from);
-    this->m_vertexes.insert(to);
-
-    auto it = this->m_edges.find(from);
-
-    if (it != this->m_edges.end())
+    if (value == EPSILON)
     {
-        std::map<char, std::set<int>> &edges_map = it->second;
-        auto weight_it = edges_map.find(value);
+        if (this->m_frozen)
+            this->thaw();
 
-        if (weight_it != edges_map.end())
-        {
-            std::set<int> &destinations = weight_it->second;
-            destinations.insert(to);
-        }
+        this->add_vertex(from);
+        this->add_vertex(to);
+        this->m_builder_epsilon[from].push_back(to);
 
-        else
-        {
-            std::set<int> destinations;
-            destinations.insert(to);
-            edges_map.insert(std::make_pair(value, destinations));
-        }
+        return;
     }
 
-    else
+    unsigned char byte = static_cast<unsigned char>(value);
+    this->add_edge(from, byte, byte, to);
+}
+
+/**
+ * @brief
+ * Adds an edge labeled with a range of bytes. Any byte may be used,
+ * EPSILON included.
+ * @param from Origin vertex
+ * @param low Smallest byte of the range
+ * @param high Largest byte of the range
+ * @param to Destination vertex
+ */
+void Graph::add_edge(const int &from, const unsigned char &low,
+                     const unsigned char &high, const int &to)
+{
+    if (this->m_frozen)
+        this->thaw();
+
+    this->add_vertex(from);
+    this->add_vertex(to);
+
+    this->m_builder_edges[from].push_back({low, high, to});
+}
+
+/**
+ * @brief
+ * Compacts the edges into compressed sparse rows: per vertex offsets into
+ * one packed array of symbol edges and one packed array of epsilon edges.
+ * Edges are sorted and duplicates are dropped.
+ */
+void Graph::freeze()
+{
+    if (this->m_frozen)
+        return;
+
+    const std::size_t vertexes = this->m_builder_edges.size();
+
+    this->m_offsets.assign(vertexes + 1, 0);
+    this->m_epsilon_offsets.assign(vertexes + 1, 0);
+    this->m_transitions.clear();
+    this->m_epsilon_targets.clear();
+
+    for (std::size_t vertex = 0; vertex < vertexes; vertex++)
     {
-        std::map<char, std::set<int>> edges_map;
-        std::set<int> destinations;
+        std::vector<Transition> &edges = this->m_builder_edges[vertex];
+        std::sort(edges.begin(), edges.end());
+        edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+
+        std::vector<int> &epsilon = this->m_builder_epsilon[vertex];
+        std::sort(epsilon.begin(), epsilon.end());
+        epsilon.erase(std::unique(epsilon.begin(), epsilon.end()),
+                      epsilon.end());
+
+        this->m_offsets[vertex + 1] =
+            this->m_offsets[vertex] + static_cast<int>(edges.size());
+        this->m_epsilon_offsets[vertex + 1] =
+            this->m_epsilon_offsets[vertex] + static_cast<int>(epsilon.size());
+    }
 
-        destinations.insert(to);
-        edges_map.insert(std::make_pair(value, destinations));
+    this->m_transitions.reserve(this->m_offsets[vertexes]);
+    this->m_epsilon_targets.reserve(this->m_epsilon_offsets[vertexes]);
 
-        this->m_edges.insert(std::make_pair(from, edges_map));
+    for (std::size_t vertex = 0; vertex < vertexes; vertex++)
+    {
+        const std::vector<Transition> &edges = this->m_builder_edges[vertex];
+        this->m_transitions.insert(this->m_transitions.end(), edges.begin(),
+                                   edges.end());
+
+        const std::vector<int> &epsilon = this->m_builder_epsilon[vertex];
+        this->m_epsilon_targets.insert(this->m_epsilon_targets.end(),
+                                       epsilon.begin(), epsilon.end());
     }
+
+    std::vector<std::vector<Transition>>().swap(this->m_builder_edges);
+    std::vector<std::vector<int>>().swap(this->m_builder_epsilon);
+    this->m_frozen = true;
 }
 
 /**
@@ -265,37 +514,34 @@ int Graph::create_vertex()
 
 /**
  * @brief
- * Connects a graph to a vertex through an edge
+ * Connects a graph to a vertex through an epsilon edge. The vertexes of the
+ * connected graph are renumbered after the vertexes of this graph.
  * @param graph graph to be connected
- * @param value value of the edge
- * @return std::pair<int, int> origin and destination of the edge
+ * @param vertex vertex the graph is connected to
+ * @return std::pair<int, int> start and final vertexes of the connected graph
  */
 std::pair<int, int> Graph::connect_graph_to_vertex(
-    const std::shared_ptr<Graph> &graph, const int &value)
+    const std::shared_ptr<Graph> &graph, const int &vertex)
 {
-    int from = this->create_vertex();
-    int to = graph->get_start();
+    int offset = this->m_next;
+    this->m_next += graph->get_next();
 
-    this->add_edge(from, value, to);
+    int start = graph->get_start() + offset;
+    int final = *graph->get_final().begin() + offset;
 
-    for (const int &final : graph->get_final())
-        this->add_final(final);
+    this->add_edge(vertex, EPSILON, start);
 
-    for (const auto &it : graph->get_edges())
+    for (int from = 0; from < graph->get_next(); from++)
     {
-        const std::map<char, std::set<int>> &edges_map = it.second;
+        for (const Transition &transition : graph->get_edges(from))
+            this->add_edge(from + offset, transition.low, transition.high,
+                           transition.to + offset);
 
-        for (const auto &weight_it : edges_map)
-        {
-            const std::set<int> &destinations = weight_it.second;
-
-            for (const int &destination : destinations)
-                this->add_edge(it.first, weight_it.first,
-                               destination);
-        }
+        for (const int &destination : graph->get_epsilon_edges(from))
+            this->add_edge(from + offset, EPSILON, destination + offset);
     }
 
-    return std::make_pair(from, to);
+    return std::make_pair(start, final);
 }
 
 /**
@@ -314,17 +560,21 @@ std::string Graph::to_string() const
 
     str += "\n";
 
-    for (const auto &it : this->m_edges)
+    for (int from = 0; from < this->m_next; from++)
     {
-        const std::map<char, std::set<int>> &edges_map = it.second;
+        for (const int &destination : this->get_epsilon_edges(from))
+            str += std::to_string(from) + " " + EPSILON + " " +
+                   std::to_string(destination) + "\n";
 
-        for (const auto &weight_it : edges_map)
+        for (const Transition &transition : this->get_edges(from))
         {
-            const std::set<int> &destinations = weight_it.second;
+            str += std::to_string(from) + " " +
+                   static_cast<char>(transition.low);
 
-            for (const int &destination : destinations)
-                str += std::to_string(it.first) + " " + weight_it.first +
-                       " " + std::to_string(destination) + "\n";
+            if (transition.high != transition.low)
+                str += std::string("-") + static_cast<char>(transition.high);
+
+            str += " " + std::to_string(transition.to) + "\n";
         }
     }
 
@@ -351,25 +601,10 @@ std::set<int> Graph::e_closure(const int &vertex) const
 
         closure.insert(current);
 
-        auto it = this->m_edges.find(current);
-
-        if (it != this->m_edges.end())
+        for (const int &destination : this->get_epsilon_edges(current))
         {
-            const std::map<char, std::set<int>> &edges_map = it->second;
-
-            for (const auto &weight_it : edges_map)
-            {
-                if (weight_it.first == 'e')
-                {
-                    const std::set<int> &destinations = weight_it.second;
-
-                    for (const int &destination : destinations)
-                    {
-                        if (closure.count(destination) == 0)
-                            stack.push(destination);
-                    }
-                }
-            }
+            if (closure.count(destination) == 0)
+                stack.push(destination);
         }
     }
 
@@ -384,12 +619,17 @@ std::set<int> Graph::e_closure(const int &vertex) const
  */
 std::set<int> Graph::e_closure(const std::set<int> &vertexes) const
 {
-    std::set<int> closure;
+    std::set<int> closure(vertexes);
+    std::vector<int> stack(vertexes.begin(), vertexes.end());
 
-    for (const int &vertex : vertexes)
+    while (!stack.empty())
     {
-        std::set<int> vertex_closure = this->e_closure(vertex);
-        closure.insert(vertex_closure.begin(), vertex_closure.end());
+        int current = stack.back();
+        stack.pop_back();
+
+        for (const int &destination : this->get_epsilon_edges(current))
+            if (closure.insert(destination).second)
+                stack.push_back(destination);
     }
 
     return closure;
@@ -411,13 +651,73 @@ std::set<int> Graph::e_closure(const int &vertex,
     return closure;
 }
 
+/**
+ * @brief
+ * Handles the e closure of a set of vertexes in place. Same semantics as
+ * e_closure(const std::set<int> &), without allocating.
+ * @param vertexes vertexes to be handled, extended with their closure
+ * @param stack scratch stack reused between calls
+ */
+void Graph::e_closure(StateSet &vertexes, std::vector<int> &stack) const
+{
+    stack.clear();
+    vertexes.for_each([&](int vertex)
+                      { stack.push_back(vertex); });
+
+    while (!stack.empty())
+    {
+        int current = stack.back();
+        stack.pop_back();
+
+        for (const int &destination : this->get_epsilon_edges(current))
+            if (vertexes.insert(destination))
+                stack.push_back(destination);
+    }
+}
+
 // Methods (private)
 /**
  * @brief
- * Adds a new vertex to the graph
+ * Adds a new vertex to the graph, growing the builder form to hold it
  * @param vertex vertex to be added
  */
 void Graph::add_vertex(const int &vertex)
 {
-    this->m_vertexes.insert(vertex);
-}
\ No newline at end of file
+    if (vertex >= static_cast<int>(this->m_known_vertexes.size()))
+        this->m_known_vertexes.resize(vertex + 1, false);
+
+    if (vertex >= static_cast<int>(this->m_builder_edges.size()))
+    {
+        this->m_builder_edges.resize(vertex + 1);
+        this->m_builder_epsilon.resize(vertex + 1);
+    }
+
+    this->m_known_vertexes[vertex] = true;
+}
+
+/**
+ * @brief
+ * Expands the compressed sparse rows back into the builder form
+ */
+void Graph::thaw()
+{
+    const std::size_t vertexes = this->m_offsets.size() - 1;
+
+    this->m_builder_edges.assign(vertexes, {});
+    this->m_builder_epsilon.assign(vertexes, {});
+
+    for (std::size_t vertex = 0; vertex < vertexes; vertex++)
+    {
+        std::span<const Transition> edges = this->get_edges(vertex);
+        this->m_builder_edges[vertex].assign(edges.begin(), edges.end());
+
+        std::span<const int> epsilon = this->get_epsilon_edges(vertex);
+        this->m_builder_epsilon[vertex].assign(epsilon.begin(), epsilon.end());
+    }
+
+    std::vector<int>().swap(this->m_offsets);
+    std::vector<Transition>().swap(this->m_transitions);
+    std::vector<int>().swap(this->m_epsilon_offsets);
+    std::vector<int>().swap(this->m_epsilon_targets);
+    this->m_frozen = false;
+}
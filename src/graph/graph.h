@@ -12,16 +12,60 @@
 #define GRAPH_H
 
 // C++ Standard Libraries
+#include <map>
 #include <optional>
 #include <set>
-#include <map>
+#include <span>
 #include <string>
 #include <memory>
 #include <vector>
 
+// Project file
+#include "state_set.h"
+
 // Constants
 constexpr char EPSILON = 'E';
 
+// Structs
+/**
+ * @struct Transition
+ * @brief Edge labeled with an inclusive range of bytes, as stored in the
+ * adjacency arrays. A single symbol is a range of one byte.
+ */
+struct Transition
+{
+    unsigned char low;
+    unsigned char high;
+    int to;
+
+    auto operator<=>(const Transition &) const = default;
+
+    /**
+     * @brief
+     * Checks if a byte follows the edge
+     * @param byte Byte to be checked
+     * @return true if the byte is within the range
+     */
+    constexpr bool contains(const unsigned char &byte) const
+    {
+        return this->low <= byte && byte <= this->high;
+    }
+};
+
+/**
+ * @struct Edge
+ * @brief Edge of a graph given as a whole, used to build a frozen graph.
+ * Epsilon edges ignore their range.
+ */
+struct Edge
+{
+    int from;
+    unsigned char low;
+    unsigned char high;
+    int to;
+    bool epsilon = false;
+};
+
 // Class
 /**
  * @class Graph
@@ -33,29 +77,39 @@ public:
     // Constructors
     Graph();
     Graph(const Graph &);
+    Graph(const int &, const std::vector<Edge> &);
 
     // Destructor
     ~Graph() = default;
 
     // Access Methods
-    const std::optional<char> &get_weight(const int &, const int &) const;
+    std::optional<char> get_weight(const int &, const int &) const;
     const int &get_start() const;
     const int &get_next() const;
     const std::set<int> &get_final() const;
-    const std::set<int> &get_vertexes() const;
-    const std::map<int, std::map<char, std::set<int>>> &get_edges() const;
+    const std::vector<int> &get_final_ids(const int &) const;
+    std::set<int> get_vertexes() const;
+    std::span<const Transition> get_edges(const int &) const;
+    std::span<const int> get_epsilon_edges(const int &) const;
+    std::size_t get_edge_count() const;
+    std::size_t get_memory_usage() const;
 
     // Mutator Methods
     void set_start(const int &);
     void add_final(const int &);
     void add_final(const std::set<int> &);
+    void add_final(const int &, const int &);
 
     // Methods
     bool is_empty() const;
     bool is_final(const int &) const;
     bool contains_vertex(const int &) const;
+    bool is_frozen() const;
 
     void add_edge(const int &, const char &, const int &);
+    void add_edge(const int &, const unsigned char &, const unsigned char &,
+                  const int &);
+    void freeze();
 
     int create_vertex();
     std::pair<int, int> connect_graph_to_vertex(const std::shared_ptr<Graph> &,
@@ -65,16 +119,29 @@ public:
     std::set<int> e_closure(const int &) const;
     std::set<int> e_closure(const int &, const std::set<int> &) const;
     std::set<int> e_closure(const std::set<int> &) const;
+    void e_closure(StateSet &, std::vector<int> &) const;
 
 private:
     int m_start;
     int m_next;
     std::set<int> m_final;
-    std::set<int> m_vertexes;
-    std::map<int, std::map<char, std::set<int>>> m_edges;
+    std::map<int, std::vector<int>> m_final_ids;
+    std::vector<bool> m_known_vertexes;
+
+    // Builder form, one vector per vertex
+    std::vector<std::vector<Transition>> m_builder_edges;
+    std::vector<std::vector<int>> m_builder_epsilon;
+
+    // Frozen form, compressed sparse rows indexed by vertex
+    bool m_frozen;
+    std::vector<int> m_offsets;
+    std::vector<Transition> m_transitions;
+    std::vector<int> m_epsilon_offsets;
+    std::vector<int> m_epsilon_targets;
 
     // Private methods
     void add_vertex(const int &);
+    void thaw();
 };
 
 #endif //! GRAPH_H
\ No newline at end of file
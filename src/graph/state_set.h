@@ -0,0 +1,217 @@
+/**
+ * @file state_set.h
+ * @author Carlos Salguero
+ * @brief Declaration and implementation of the StateSet class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef STATE_SET_H
+#define STATE_SET_H
+
+// C++ Standard Library
+#include <bit>
+#include <cstdint>
+#include <set>
+#include <span>
+#include <vector>
+
+// Class
+/**
+ * @class StateSet
+ * @brief Dense bitset of NFA vertexes, used as the key of a DFA state
+ * during the subset construction.
+ */
+class StateSet
+{
+public:
+    // Constructors
+    StateSet() = default;
+
+    /**
+     * @brief
+     * Construct a new StateSet object able to hold vertexes [0, size)
+     * @param size number of vertexes of the NFA
+     */
+    explicit StateSet(const int &size)
+        : m_size(size), m_words((size + 63) / 64, 0)
+    {
+    }
+
+    // Access Methods
+    /**
+     * @brief
+     * Get the number of vertexes the set can hold
+     * @return int capacity of the set
+     */
+    int get_size() const
+    {
+        return this->m_size;
+    }
+
+    /**
+     * @brief
+     * Get the underlying words of the bitset
+     * @return const std::vector<std::uint64_t>& words
+     */
+    const std::vector<std::uint64_t> &get_words() const
+    {
+        return this->m_words;
+    }
+
+    // Methods
+    /**
+     * @brief
+     * Checks if the set contains a vertex
+     * @param vertex vertex to be checked
+     * @return true if the vertex is in the set
+     */
+    bool contains(const int &vertex) const
+    {
+        return (this->m_words[vertex >> 6] >> (vertex & 63)) & 1;
+    }
+
+    /**
+     * @brief
+     * Inserts a vertex into the set
+     * @param vertex vertex to be inserted
+     * @return true if the vertex was not in the set
+     */
+    bool insert(const int &vertex)
+    {
+        std::uint64_t &word = this->m_words[vertex >> 6];
+        std::uint64_t mask = std::uint64_t(1) << (vertex & 63);
+
+        if (word & mask)
+            return false;
+
+        word |= mask;
+        return true;
+    }
+
+    /**
+     * @brief
+     * Adds the vertexes of a run of words to the set
+     * @param first index of the word the run starts at
+     * @param words words of the run, which must fit in the set
+     */
+    void unite(const std::size_t &first, std::span<const std::uint64_t> words)
+    {
+        for (std::size_t i = 0; i < words.size(); i++)
+            this->m_words[first + i] |= words[i];
+    }
+
+    /**
+     * @brief
+     * Removes every vertex from the set, keeping its capacity
+     */
+    void clear()
+    {
+        for (std::uint64_t &word : this->m_words)
+            word = 0;
+    }
+
+    /**
+     * @brief
+     * Checks if the set is empty
+     * @return true if no vertex is in the set
+     */
+    bool empty() const
+    {
+        for (const std::uint64_t &word : this->m_words)
+            if (word != 0)
+                return false;
+
+        return true;
+    }
+
+    /**
+     * @brief
+     * Checks if the set shares a vertex with another set of the same size
+     * @param other set to be checked
+     * @return true if both sets have a vertex in common
+     */
+    bool intersects(const StateSet &other) const
+    {
+        for (std::size_t i = 0; i < this->m_words.size(); i++)
+            if (this->m_words[i] & other.m_words[i])
+                return true;
+
+        return false;
+    }
+
+    /**
+     * @brief
+     * Calls a function for every vertex of the set in increasing order
+     * @param function function receiving the vertex
+     */
+    template <typename Function>
+    void for_each(Function function) const
+    {
+        for (std::size_t i = 0; i < this->m_words.size(); i++)
+        {
+            std::uint64_t word = this->m_words[i];
+
+            while (word != 0)
+            {
+                function(static_cast<int>(i * 64 + std::countr_zero(word)));
+                word &= word - 1;
+            }
+        }
+    }
+
+    /**
+     * @brief
+     * Converts the set to an ordered set
+     * @return std::set<int> vertexes of the set
+     */
+    std::set<int> to_set() const
+    {
+        std::set<int> vertexes;
+        this->for_each([&](int vertex)
+                       { vertexes.insert(vertex); });
+
+        return vertexes;
+    }
+
+    /**
+     * @brief
+     * Hashes the words of the set
+     * @return std::size_t hash of the set
+     */
+    std::size_t hash() const
+    {
+        std::uint64_t hash = 0x9e3779b97f4a7c15ull;
+
+        for (const std::uint64_t &word : this->m_words)
+        {
+            hash ^= word + 0x9e3779b97f4a7c15ull + (hash << 6) + (hash >> 2);
+            hash *= 0xff51afd7ed558ccdull;
+        }
+
+        return static_cast<std::size_t>(hash ^ (hash >> 33));
+    }
+
+    bool operator==(const StateSet &) const = default;
+
+private:
+    int m_size = 0;
+    std::vector<std::uint64_t> m_words;
+};
+
+/**
+ * @struct StateSetHash
+ * @brief Hash functor to key hash tables on a StateSet
+ */
+struct StateSetHash
+{
+    std::size_t operator()(const StateSet &set) const
+    {
+        return set.hash();
+    }
+};
+
+#endif //! STATE_SET_H
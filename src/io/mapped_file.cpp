@@ -0,0 +1,162 @@
+/**
+ * @file mapped_file.cpp
+ * @author Carlos Salguero
+ * @brief Implementation of the MappedFile class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+// C++ Standard Library
+#include <cerrno>
+#include <system_error>
+#include <utility>
+
+// POSIX
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Project files
+#include "mapped_file.h"
+
+// Constructors
+/**
+ * @brief
+ * Construct a new MappedFile:: MappedFile object, mapping the whole file
+ * read-only. Empty files are not mapped and have empty data.
+ * @param path Path of the file
+ * @throws std::system_error if the file cannot be opened or mapped
+ */
+MappedFile::MappedFile(const std::string &path)
+    : m_path(path), m_data(nullptr), m_size(0)
+{
+    int descriptor = ::open(path.c_str(), O_RDONLY);
+
+    if (descriptor < 0)
+        throw std::system_error(errno, std::generic_category(), path);
+
+    struct stat status;
+
+    if (::fstat(descriptor, &status) < 0)
+    {
+        int error = errno;
+        ::close(descriptor);
+
+        throw std::system_error(error, std::generic_category(), path);
+    }
+
+    this->m_size = static_cast<std::size_t>(status.st_size);
+
+    if (this->m_size > 0)
+    {
+        void *data = ::mmap(nullptr, this->m_size, PROT_READ, MAP_PRIVATE,
+                            descriptor, 0);
+
+        if (data == MAP_FAILED)
+        {
+            int error = errno;
+            ::close(descriptor);
+
+            throw std::system_error(error, std::generic_category(), path);
+        }
+
+        ::madvise(data, this->m_size, MADV_SEQUENTIAL);
+        this->m_data = static_cast<const char *>(data);
+    }
+
+    // The mapping outlives the descriptor
+    ::close(descriptor);
+}
+
+/**
+ * @brief
+ * Construct a new MappedFile:: MappedFile object, taking over the mapping
+ * of another one
+ * @param other Mapped file to be moved
+ */
+MappedFile::MappedFile(MappedFile &&other) noexcept
+    : m_path(std::move(other.m_path)),
+      m_data(std::exchange(other.m_data, nullptr)),
+      m_size(std::exchange(other.m_size, 0))
+{
+}
+
+// Destructor
+/**
+ * @brief
+ * Destroy the MappedFile:: MappedFile object, unmapping the file
+ */
+MappedFile::~MappedFile()
+{
+    this->unmap();
+}
+
+// Operators
+/**
+ * @brief
+ * Takes over the mapping of another mapped file
+ * @param other Mapped file to be moved
+ * @return MappedFile& this mapped file
+ */
+MappedFile &MappedFile::operator=(MappedFile &&other) noexcept
+{
+    if (this != &other)
+    {
+        this->unmap();
+
+        this->m_path = std::move(other.m_path);
+        this->m_data = std::exchange(other.m_data, nullptr);
+        this->m_size = std::exchange(other.m_size, 0);
+    }
+
+    return *this;
+}
+
+// Access Methods
+/**
+ * @brief
+ * Get the path the file was mapped from
+ * @return const std::string& path
+ */
+const std::string &MappedFile::get_path() const
+{
+    return this->m_path;
+}
+
+/**
+ * @brief
+ * Get the contents of the file
+ * @return std::string_view contents, valid while the file is mapped
+ */
+std::string_view MappedFile::get_data() const
+{
+    return std::string_view(this->m_data, this->m_size);
+}
+
+/**
+ * @brief
+ * Get the size of the file
+ * @return std::size_t size in bytes
+ */
+std::size_t MappedFile::get_size() const
+{
+    return this->m_size;
+}
+
+// Methods (private)
+/**
+ * @brief
+ * Unmaps the file, if it is mapped
+ */
+void MappedFile::unmap()
+{
+    if (this->m_data != nullptr)
+        ::munmap(const_cast<char *>(this->m_data), this->m_size);
+
+    this->m_data = nullptr;
+    this->m_size = 0;
+}
@@ -0,0 +1,55 @@
+/**
+ * @file mapped_file.h
+ * @author Carlos Salguero
+ * @brief Declaration of the MappedFile class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+// C++ Standard Library
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+// Class
+/**
+ * @class MappedFile
+ * @brief Whole file mapped read-only into memory, so that it can be
+ * scanned in place without read() copies
+ */
+class MappedFile
+{
+public:
+    // Constructors
+    MappedFile(const std::string &);
+    MappedFile(const MappedFile &) = delete;
+    MappedFile(MappedFile &&) noexcept;
+
+    // Destructor
+    ~MappedFile();
+
+    // Operators
+    MappedFile &operator=(const MappedFile &) = delete;
+    MappedFile &operator=(MappedFile &&) noexcept;
+
+    // Access Methods
+    const std::string &get_path() const;
+    std::string_view get_data() const;
+    std::size_t get_size() const;
+
+private:
+    std::string m_path;
+    const char *m_data;
+    std::size_t m_size;
+
+    // Methods
+    void unmap();
+};
+
+#endif //! MAPPED_FILE_H
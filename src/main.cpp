@@ -10,20 +10,408 @@
  */
 
 // C++ Standard Library
+#include <algorithm>
+#include <cstring>
+#include <exception>
+#include <fstream>
 #include <iostream>
 #include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
 
 // Project files
-#include "Graph/graph.h"
-#include "automata/automata.h"
+#include "graph/graph.h"
+#include "io/mapped_file.h"
+#include "matcher/span_matcher.h"
+#include "regex/regex.h"
+
+// Constants
+constexpr const char *DEFAULT_PATTERN_FILE = "regex.txt";
+constexpr unsigned MAX_JOBS = 1024;
+
+// Structs
+/**
+ * @struct Options
+ * @brief Command line options
+ */
+struct Options
+{
+    std::string pattern;
+    std::vector<std::string> files;
+    bool count = false;
+    bool only_matching = false;
+    unsigned jobs = 1;
+};
+
+// Functions
+/**
+ * @brief
+ * Prints how to call the program
+ * @param program Name of the program
+ */
+static void print_usage(const char *program)
+{
+    std::cerr << "usage: " << program
+              << " [-c] [-o] [-j jobs] [-f pattern_file | pattern] [file...]\n"
+              << "  Prints the byte offset and text of every line of the\n"
+              << "  files matching the pattern, or its NFA if no file is\n"
+              << "  given. The pattern defaults to the first line of "
+              << DEFAULT_PATTERN_FILE << ".\n"
+              << "  -c  print the number of matching lines instead\n"
+              << "  -o  print the byte offset and text of every non-empty\n"
+              << "      leftmost-longest match instead of the whole line\n"
+              << "  -j  scan every file with this many threads, from 1 to "
+              << MAX_JOBS << "\n";
+}
+
+/**
+ * @brief
+ * Reads the pattern from the first line of a file
+ * @param path Path of the file
+ * @return std::string pattern
+ */
+static std::string read_pattern(const std::string &path)
+{
+    std::ifstream file(path);
+    std::string pattern;
+
+    if (!file || !std::getline(file, pattern))
+        throw std::runtime_error("cannot read a pattern from " + path);
+
+    return pattern;
+}
+
+/**
+ * @brief
+ * Parses a number of threads, made only of decimal digits
+ * @param text Text of the number
+ * @param jobs Parsed number of threads
+ * @return true if the number is between 1 and MAX_JOBS
+ */
+static bool parse_jobs(const char *text, unsigned &jobs)
+{
+    unsigned value = 0;
+
+    if (*text == '\0')
+        return false;
+
+    for (; *text != '\0'; text++)
+    {
+        if (*text < '0' || *text > '9')
+            return false;
+
+        value = 10 * value + static_cast<unsigned>(*text - '0');
+
+        if (value > MAX_JOBS)
+            return false;
+    }
+
+    if (value == 0)
+        return false;
+
+    jobs = value;
+    return true;
+}
+
+/**
+ * @brief
+ * Parses the command line
+ * @param argc Number of arguments
+ * @param argv Arguments
+ * @param options Parsed options
+ * @return true if the command line is valid
+ */
+static bool parse_options(int argc, char **argv, Options &options)
+{
+    bool has_pattern = false;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (std::strcmp(argv[i], "-c") == 0)
+            options.count = true;
+
+        else if (std::strcmp(argv[i], "-o") == 0)
+            options.only_matching = true;
+
+        else if (std::strcmp(argv[i], "-j") == 0)
+        {
+            if (i + 1 == argc || !parse_jobs(argv[++i], options.jobs))
+                return false;
+        }
+
+        else if (std::strcmp(argv[i], "-f") == 0)
+        {
+            if (i + 1 == argc || has_pattern)
+                return false;
+
+            options.pattern = read_pattern(argv[++i]);
+            has_pattern = true;
+        }
+
+        else if (argv[i][0] == '-' && argv[i][1] != '\0')
+            return false;
+
+        else if (!has_pattern)
+        {
+            options.pattern = argv[i];
+            has_pattern = true;
+        }
+
+        else
+            options.files.push_back(argv[i]);
+    }
+
+    if (!has_pattern)
+        options.pattern = read_pattern(DEFAULT_PATTERN_FILE);
+
+    return true;
+}
+
+/**
+ * @brief
+ * Compiles the matcher of the spans of a pattern for -o. Its DFAs are
+ * bounded by the same state budget as the Regex, and a pattern the Regex
+ * already had to run lazily is rejected without determinizing it again.
+ * @param regex Compiled pattern
+ * @return std::unique_ptr<SpanMatcher> matcher of the spans
+ * @throws std::runtime_error if a table of the matcher exceeds the budget
+ */
+static std::unique_ptr<SpanMatcher> compile_spans(const Regex &regex)
+{
+    const std::string message =
+        "-o needs the DFA of the pattern, which exceeds " +
+        std::to_string(REGEX_DFA_STATE_BUDGET) + " states";
+
+    if (regex.get_engine() == Engine::LAZY_DFA)
+        throw std::runtime_error(message);
+
+    try
+    {
+        return std::make_unique<SpanMatcher>(*regex.get_nfa(),
+                                             REGEX_DFA_STATE_BUDGET);
+    }
+
+    catch (const std::length_error &)
+    {
+        throw std::runtime_error(message);
+    }
+}
+
+/**
+ * @brief
+ * Scans the lines of a range of a mapped file in place. When every match
+ * contains a literal, the range is searched for it first and only the lines
+ * holding an occurrence reach the matcher.
+ * @param regex Compiled pattern
+ * @param spans Matcher of the spans of the pattern, null unless -o is given
+ * @param file Mapped file
+ * @param begin Offset of the first line of the range
+ * @param end Offset past the last line of the range
+ * @param options Command line options
+ * @param prefix Whether to print the path before every line
+ * @param output Stream the matching lines are printed to
+ * @return std::size_t number of matching lines
+ */
+static std::size_t scan_lines(const Regex &regex, const SpanMatcher *spans,
+                              const MappedFile &file, std::size_t begin,
+                              const std::size_t &end,
+                              const Options &options, const bool &prefix,
+                              std::ostream &output)
+{
+    std::string_view data = file.get_data().substr(0, end);
+    const Prefilter &prefilter = regex.get_prefilter();
+    MatchScratch scratch;
+    std::size_t matches = 0;
+
+    while (begin < data.size())
+    {
+        if (!prefilter.is_empty())
+        {
+            std::size_t candidate = prefilter.find(data, begin);
+
+            if (candidate == std::string_view::npos)
+                break;
+
+            std::size_t line_start = candidate == begin
+                                         ? std::string_view::npos
+                                         : data.rfind('\n', candidate - 1);
+
+            if (line_start != std::string_view::npos && line_start >= begin)
+                begin = line_start + 1;
+        }
+
+        std::size_t line_end = data.find('\n', begin);
+
+        if (line_end == std::string_view::npos)
+            line_end = data.size();
+
+        std::string_view line = data.substr(begin, line_end - begin);
+
+        if (regex.find(line, scratch).has_value())
+        {
+            matches++;
+
+            if (spans != nullptr && !options.count)
+            {
+                for (const MatchSpan &span : spans->find_all(line, true))
+                {
+                    if (prefix)
+                        output << file.get_path() << ':';
+
+                    output << begin + span.start << ':'
+                           << line.substr(span.start, span.end - span.start)
+                           << '\n';
+                }
+            }
+
+            else if (!options.count)
+            {
+                if (prefix)
+                    output << file.get_path() << ':';
+
+                output << begin << ':' << line << '\n';
+            }
+        }
+
+        begin = line_end + 1;
+    }
+
+    return matches;
+}
+
+/**
+ * @brief
+ * Scans a mapped file in place. With several jobs the file is split at line
+ * boundaries into one range per thread; lines never depend on each other,
+ * so every range starts from the start state and the outputs are printed
+ * in file order.
+ * @param regex Compiled pattern
+ * @param spans Matcher of the spans of the pattern, null unless -o is given
+ * @param file Mapped file
+ * @param options Command line options
+ * @param prefix Whether to print the path before every line
+ * @return std::size_t number of matching lines
+ */
+static std::size_t scan_file(const Regex &regex, const SpanMatcher *spans,
+                             const MappedFile &file, const Options &options,
+                             const bool &prefix)
+{
+    std::string_view data = file.get_data();
+    std::size_t matches = 0;
+
+    if (options.jobs <= 1)
+        matches = scan_lines(regex, spans, file, 0, data.size(), options,
+                             prefix, std::cout);
+
+    else
+    {
+        std::vector<std::size_t> bounds(options.jobs + 1, data.size());
+        bounds[0] = 0;
+
+        for (unsigned i = 1; i < options.jobs; i++)
+        {
+            std::size_t split = std::max(bounds[i - 1],
+                                         data.size() * i / options.jobs);
+            std::size_t line_end = data.find('\n', split);
+
+            bounds[i] = line_end == std::string_view::npos ? data.size()
+                                                           : line_end + 1;
+        }
+
+        std::vector<std::ostringstream> outputs(options.jobs);
+        std::vector<std::size_t> counts(options.jobs, 0);
+        std::vector<std::thread> workers;
+
+        for (unsigned i = 0; i < options.jobs; i++)
+            workers.emplace_back([&, i]()
+                                 { counts[i] = scan_lines(
+                                       regex, spans, file, bounds[i],
+                                       bounds[i + 1], options, prefix,
+                                       outputs[i]); });
+
+        for (unsigned i = 0; i < options.jobs; i++)
+        {
+            workers[i].join();
+
+            std::cout << outputs[i].view();
+            matches += counts[i];
+        }
+    }
+
+    if (options.count)
+    {
+        if (prefix)
+            std::cout << file.get_path() << ':';
+
+        std::cout << matches << '\n';
+    }
+
+    return matches;
+}
 
 int main(int argc, char **argv)
 {
-    std::shared_ptr<Automata> automata =
-        std::make_shared<Automata>("a+b*");
+    std::ios::sync_with_stdio(false);
+
+    try
+    {
+        Options options;
+
+        if (!parse_options(argc, argv, options))
+        {
+            print_usage(argv[0]);
+            return 2;
+        }
+
+        Regex regex(options.pattern);
+
+        if (options.files.empty())
+        {
+            std::cout << "NFA GRAPH: " << std::endl;
+            std::cout << regex.get_nfa()->to_string() << std::endl;
+
+            return 0;
+        }
+
+        std::unique_ptr<SpanMatcher> spans;
+
+        if (options.only_matching && !options.count)
+            spans = compile_spans(regex);
+
+        std::size_t matches = 0;
+        bool failed = false;
+
+        for (const std::string &path : options.files)
+        {
+            try
+            {
+                MappedFile file(path);
+                matches += scan_file(regex, spans.get(), file, options,
+                                     options.files.size() > 1);
+            }
+
+            catch (const std::exception &error)
+            {
+                std::cerr << argv[0] << ": " << error.what() << std::endl;
+                failed = true;
+            }
+        }
+
+        std::cout.flush();
+
+        if (failed)
+            return 2;
 
-    std::shared_ptr<Graph> NFA_graph = automata->build();
+        return matches > 0 ? 0 : 1;
+    }
 
-    std::cout << "NFA GRAPH: " << std::endl;
-    std::cout << NFA_graph->to_string() << std::endl;
-}
\ No newline at end of file
+    catch (const std::exception &error)
+    {
+        std::cerr << argv[0] << ": " << error.what() << std::endl;
+        return 2;
+    }
+}
@@ -0,0 +1,179 @@
+/**
+ * @file bit_parallel_matcher.cpp
+ * @author Carlos Salguero
+ * @brief Implementation of the BitParallelMatcher class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+// C++ Standard Library
+#include <stdexcept>
+
+// Project files
+#include "bit_parallel_matcher.h"
+#include "../graph/closure_table.h"
+
+// Constructors
+/**
+ * @brief
+ * Construct a new BitParallelMatcher:: BitParallelMatcher object. The
+ * follow set of a position is every position whose edge leaves a vertex
+ * of the epsilon closure of its destination.
+ * @param nfa NFA with at most BIT_PARALLEL_MAX_POSITIONS symbol edges
+ */
+BitParallelMatcher::BitParallelMatcher(const Graph &nfa)
+{
+    if (!fits(nfa))
+        throw std::length_error("too many positions for a bit-parallel NFA");
+
+    const ClosureTable closures(nfa);
+    const int vertexes = nfa.get_next();
+
+    // Positions leaving each vertex, and the destination of each position
+    std::vector<std::uint64_t> leaving(vertexes, 0);
+    std::vector<int> destinations(1, nfa.get_start());
+
+    this->m_masks.fill(0);
+
+    for (int vertex = 0; vertex < vertexes; vertex++)
+    {
+        for (const Transition &transition : nfa.get_edges(vertex))
+        {
+            std::uint64_t bit = std::uint64_t(1) << destinations.size();
+
+            leaving[vertex] |= bit;
+            for (int byte = transition.low; byte <= transition.high; byte++)
+                this->m_masks[byte] |= bit;
+            destinations.push_back(transition.to);
+        }
+    }
+
+    this->m_positions = static_cast<int>(destinations.size());
+
+    // Follow and last sets, position 0 being the start vertex
+    std::vector<std::uint64_t> follow(this->m_positions, 0);
+    this->m_last = 0;
+
+    for (int position = 0; position < this->m_positions; position++)
+    {
+        closures.for_each(destinations[position], [&](int vertex)
+                          {
+            follow[position] |= leaving[vertex];
+
+            if (nfa.is_final(vertex))
+                this->m_last |= std::uint64_t(1) << position; });
+    }
+
+    this->m_first = follow[0];
+
+    // One table per byte of the state
+    this->m_follow.assign((this->m_positions + 7) / 8, {});
+
+    for (std::size_t chunk = 0; chunk < this->m_follow.size(); chunk++)
+    {
+        for (int value = 0; value < 256; value++)
+        {
+            std::uint64_t next = 0;
+
+            for (int bit = 0; bit < 8; bit++)
+            {
+                int position = static_cast<int>(chunk) * 8 + bit;
+
+                if ((value >> bit & 1) && position < this->m_positions)
+                    next |= follow[position];
+            }
+
+            this->m_follow[chunk][value] = next;
+        }
+    }
+}
+
+// Access Methods
+/**
+ * @brief
+ * Get the number of positions, initial position included
+ * @return int number of positions
+ */
+int BitParallelMatcher::get_position_count() const
+{
+    return this->m_positions;
+}
+
+/**
+ * @brief
+ * Get the memory used by the masks and follow tables
+ * @return std::size_t size in bytes
+ */
+std::size_t BitParallelMatcher::get_memory_usage() const
+{
+    return sizeof(BitParallelMatcher) +
+           this->m_follow.size() * sizeof(this->m_follow[0]);
+}
+
+// Methods
+/**
+ * @brief
+ * Checks if the NFA has few enough symbol edges to fit in a word
+ * @param nfa NFA to be checked
+ * @return true if the NFA fits
+ */
+bool BitParallelMatcher::fits(const Graph &nfa)
+{
+    std::size_t positions = 0;
+
+    for (int vertex = 0; vertex < nfa.get_next(); vertex++)
+        positions += nfa.get_edges(vertex).size();
+
+    return positions <= BIT_PARALLEL_MAX_POSITIONS;
+}
+
+/**
+ * @brief
+ * Checks if the whole input belongs to the language of the NFA
+ * @param input Input to be matched
+ * @return true if the input is accepted
+ */
+bool BitParallelMatcher::match(std::string_view input) const
+{
+    std::uint64_t state = 1;
+
+    for (const char &character : input)
+    {
+        state = this->follow(state) &
+                this->m_masks[static_cast<unsigned char>(character)];
+
+        if (state == 0)
+            return false;
+    }
+
+    return (state & this->m_last) != 0;
+}
+
+/**
+ * @brief
+ * Searches the input for the first position where a match ends
+ * @param input Input to be searched
+ * @return std::optional<std::size_t> end offset of the earliest ending
+ * match, empty if there is no match
+ */
+std::optional<std::size_t> BitParallelMatcher::find(std::string_view input) const
+{
+    if (this->m_last & 1)
+        return 0;
+
+    std::uint64_t state = 0;
+
+    for (std::size_t i = 0; i < input.size(); i++)
+    {
+        state = (this->follow(state) | this->m_first) &
+                this->m_masks[static_cast<unsigned char>(input[i])];
+
+        if (state & this->m_last)
+            return i + 1;
+    }
+
+    return std::nullopt;
+}
@@ -0,0 +1,86 @@
+/**
+ * @file bit_parallel_matcher.h
+ * @author Carlos Salguero
+ * @brief Declaration of the BitParallelMatcher class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef BIT_PARALLEL_MATCHER_H
+#define BIT_PARALLEL_MATCHER_H
+
+// C++ Standard Library
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+// Project files
+#include "../graph/graph.h"
+
+// Constants
+constexpr int BIT_PARALLEL_MAX_POSITIONS = 63;
+
+// Class
+/**
+ * @class BitParallelMatcher
+ * @brief Simulation of the position (Glushkov) automaton of a small NFA
+ * with one machine word.
+ *
+ * Every symbol edge of the Thompson NFA is a position, bit 0 is the
+ * initial position. A step is D = follow(D) & B[byte], where follow(D) is
+ * the union of one table lookup per byte of D.
+ */
+class BitParallelMatcher
+{
+public:
+    // Constructors
+    BitParallelMatcher(const Graph &);
+
+    // Destructor
+    ~BitParallelMatcher() = default;
+
+    // Access Methods
+    int get_position_count() const;
+    std::size_t get_memory_usage() const;
+
+    // Methods
+    static bool fits(const Graph &);
+
+    bool match(std::string_view) const;
+    std::optional<std::size_t> find(std::string_view) const;
+
+private:
+    int m_positions;
+    std::uint64_t m_first;
+    std::uint64_t m_last;
+    std::array<std::uint64_t, 256> m_masks;
+    std::vector<std::array<std::uint64_t, 256>> m_follow;
+
+    // Methods
+    /**
+     * @brief
+     * Union of the follow sets of the positions of a state
+     * @param state set of active positions
+     * @return std::uint64_t positions that may come next
+     */
+    std::uint64_t follow(std::uint64_t state) const
+    {
+        std::uint64_t next = 0;
+
+        for (const std::array<std::uint64_t, 256> &table : this->m_follow)
+        {
+            next |= table[state & 0xff];
+            state >>= 8;
+        }
+
+        return next;
+    }
+};
+
+#endif //! BIT_PARALLEL_MATCHER_H
@@ -0,0 +1,304 @@
+/**
+ * @file lazy_dfa.cpp
+ * @author Carlos Salguero
+ * @brief Implementation of the LazyDfa class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+// C++ Standard Library
+#include <algorithm>
+
+// Project files
+#include "lazy_dfa.h"
+
+// Constants
+static constexpr int LAZY_DEAD = -1;
+static constexpr int LAZY_UNKNOWN = -2;
+
+// Constructors
+/**
+ * @brief
+ * Construct a new LazyDfa:: LazyDfa object
+ * @param nfa NFA to be determinized, as returned by Automata::build
+ * @param max_states Maximum number of cached DFA states
+ */
+LazyDfa::LazyDfa(const std::shared_ptr<Graph> &nfa,
+                 const std::size_t &max_states)
+    : m_nfa(nfa), m_closures(std::make_shared<const ClosureTable>(*nfa)), m_classes(*nfa),
+      m_representatives(m_classes.get_representatives()),
+      m_max_states(std::max<std::size_t>(max_states, 2))
+{
+    const int size = this->m_nfa->get_next();
+
+    this->m_stride = this->m_classes.get_class_count();
+    this->m_search_bit = size;
+
+    this->m_final = StateSet(size + 1);
+    for (const int &final : this->m_nfa->get_final())
+        this->m_final.insert(final);
+
+    this->m_moved = StateSet(size + 1);
+    this->m_moved.insert(this->m_nfa->get_start());
+
+    this->m_start_set = StateSet(size + 1);
+    this->m_closures->close(this->m_moved, this->m_start_set);
+
+    this->m_search_start_set = this->m_start_set;
+    this->m_search_start_set.insert(this->m_search_bit);
+
+    this->m_next = StateSet(size + 1);
+    this->m_start = -1;
+    this->m_search_start = -1;
+}
+
+// Access Methods
+/**
+ * @brief
+ * Get the cache counters
+ * @return const LazyDfaStats& counters
+ */
+const LazyDfaStats &LazyDfa::get_stats() const
+{
+    return this->m_stats;
+}
+
+/**
+ * @brief
+ * Get the number of DFA states currently cached
+ * @return std::size_t number of states
+ */
+std::size_t LazyDfa::get_cached_state_count() const
+{
+    return this->m_sets.size();
+}
+
+/**
+ * @brief
+ * Get the state budget of the cache
+ * @return std::size_t maximum number of states
+ */
+std::size_t LazyDfa::get_max_states() const
+{
+    return this->m_max_states;
+}
+
+/**
+ * @brief
+ * Get the memory used by the closure table and the cached states
+ * @return std::size_t size in bytes, the closure table counted in full
+ * even when copies share it
+ */
+std::size_t LazyDfa::get_memory_usage() const
+{
+    std::size_t usage = sizeof(LazyDfa) + this->m_closures->get_memory_usage() +
+                        this->m_transitions.size() * sizeof(int) +
+                        this->m_accepting.size() / 8;
+
+    for (const StateSet &set : this->m_sets)
+        usage += sizeof(StateSet) +
+                 set.get_words().size() * sizeof(std::uint64_t);
+
+    return usage;
+}
+
+// Methods (public)
+/**
+ * @brief
+ * Checks if the whole input belongs to the language of the NFA
+ * @param input Input to be matched
+ * @return true if the input is accepted
+ */
+bool LazyDfa::match(std::string_view input)
+{
+    int state = this->get_start(false);
+
+    for (const char &character : input)
+    {
+        int class_id = this->m_classes.get_class(
+            static_cast<unsigned char>(character));
+        int next = this->m_transitions[state * this->m_stride + class_id];
+
+        if (next == LAZY_UNKNOWN)
+        {
+            this->m_stats.misses++;
+            next = this->compute(state, class_id);
+        }
+
+        else
+            this->m_stats.hits++;
+
+        if (next == LAZY_DEAD)
+            return false;
+
+        state = next;
+    }
+
+    return this->m_accepting[state];
+}
+
+/**
+ * @brief
+ * Searches the input for the first position where a match ends
+ * @param input Input to be searched
+ * @return std::optional<std::size_t> end offset of the earliest ending
+ * match, empty if there is no match
+ */
+std::optional<std::size_t> LazyDfa::find(std::string_view input)
+{
+    int state = this->get_start(true);
+
+    if (this->m_accepting[state])
+        return 0;
+
+    for (std::size_t i = 0; i < input.size(); i++)
+    {
+        int class_id = this->m_classes.get_class(
+            static_cast<unsigned char>(input[i]));
+        int next = this->m_transitions[state * this->m_stride + class_id];
+
+        if (next == LAZY_UNKNOWN)
+        {
+            this->m_stats.misses++;
+            next = this->compute(state, class_id);
+        }
+
+        else
+            this->m_stats.hits++;
+
+        state = next;
+
+        if (this->m_accepting[state])
+            return i + 1;
+    }
+
+    return std::nullopt;
+}
+
+/**
+ * @brief
+ * Resets the cache counters, keeping the cached states
+ */
+void LazyDfa::reset_stats()
+{
+    this->m_stats = LazyDfaStats();
+}
+
+// Methods (private)
+/**
+ * @brief
+ * Adds a set of NFA vertexes to the cache, the cache must have room for it
+ * @param set set of NFA vertexes
+ * @return int id of the DFA state
+ */
+int LazyDfa::intern(const StateSet &set)
+{
+    auto [it, inserted] =
+        this->m_ids.try_emplace(set, static_cast<int>(this->m_sets.size()));
+
+    if (!inserted)
+        return it->second;
+
+    this->m_sets.push_back(set);
+    this->m_accepting.push_back(set.intersects(this->m_final));
+    this->m_transitions.resize(this->m_sets.size() * this->m_stride,
+                               LAZY_UNKNOWN);
+    this->m_stats.states_created++;
+
+    return it->second;
+}
+
+/**
+ * @brief
+ * Determinizes the transition of a cached state on a byte class, flushing
+ * the cache first if the new state does not fit
+ * @param state origin DFA state
+ * @param class_id byte class
+ * @return int destination DFA state, LAZY_DEAD if there is none
+ */
+int LazyDfa::compute(const int &state, const int &class_id)
+{
+    const bool search = this->m_sets[state].contains(this->m_search_bit);
+
+    this->m_moved.clear();
+    this->m_sets[state].for_each([&](int vertex)
+                                 {
+        for (const Transition &transition : this->m_nfa->get_edges(vertex))
+            if (transition.contains(this->m_representatives[class_id]))
+                this->m_moved.insert(transition.to); });
+
+    this->m_closures->close(this->m_moved, this->m_next);
+
+    if (search)
+        this->m_search_start_set.for_each([&](int vertex)
+                                          { this->m_next.insert(vertex); });
+
+    int origin = state;
+
+    if (this->m_next.empty())
+    {
+        this->m_transitions[origin * this->m_stride + class_id] = LAZY_DEAD;
+        return LAZY_DEAD;
+    }
+
+    auto it = this->m_ids.find(this->m_next);
+    int target;
+
+    if (it != this->m_ids.end())
+        target = it->second;
+
+    else
+    {
+        if (this->m_sets.size() + 1 > this->m_max_states)
+        {
+            StateSet current = this->m_sets[state];
+
+            this->flush();
+            origin = this->intern(current);
+        }
+
+        target = this->intern(this->m_next);
+    }
+
+    this->m_transitions[origin * this->m_stride + class_id] = target;
+    return target;
+}
+
+/**
+ * @brief
+ * Get the cached start state, creating it if needed
+ * @param search true for the unanchored start state
+ * @return int id of the start state
+ */
+int LazyDfa::get_start(const bool &search)
+{
+    int &start = search ? this->m_search_start : this->m_start;
+
+    if (start >= 0)
+        return start;
+
+    if (this->m_sets.size() + 1 > this->m_max_states)
+        this->flush();
+
+    start = this->intern(search ? this->m_search_start_set
+                                : this->m_start_set);
+    return start;
+}
+
+/**
+ * @brief
+ * Drops every cached state
+ */
+void LazyDfa::flush()
+{
+    this->m_ids.clear();
+    this->m_sets.clear();
+    this->m_transitions.clear();
+    this->m_accepting.clear();
+    this->m_start = -1;
+    this->m_search_start = -1;
+    this->m_stats.flushes++;
+}
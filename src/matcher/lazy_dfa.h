@@ -0,0 +1,114 @@
+/**
+ * @file lazy_dfa.h
+ * @author Carlos Salguero
+ * @brief Declaration of the LazyDfa class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef LAZY_DFA_H
+#define LAZY_DFA_H
+
+// C++ Standard Library
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// Project files
+#include "../graph/closure_table.h"
+#include "../graph/graph.h"
+#include "../graph/state_set.h"
+#include "../automata/byte_classes.h"
+
+// Constants
+constexpr std::size_t LAZY_DFA_DEFAULT_STATES = 4096;
+
+// Structs
+/**
+ * @struct LazyDfaStats
+ * @brief Counters of the state cache of a LazyDfa
+ */
+struct LazyDfaStats
+{
+    std::size_t hits = 0;
+    std::size_t misses = 0;
+    std::size_t flushes = 0;
+    std::size_t states_created = 0;
+};
+
+// Class
+/**
+ * @class LazyDfa
+ * @brief DFA determinized on the fly from a Thompson NFA.
+ *
+ * A DFA state is created only when the input first drives the matcher into
+ * it, and is kept in a cache of at most max_states states. When the cache
+ * is full it is flushed and rebuilt from the current state.
+ *
+ * Matching fills the cache, so a LazyDfa must not be shared across
+ * threads. Copies share the NFA and its closure table and own their cache,
+ * so each thread copies one from a common prototype without computing the
+ * closures again.
+ */
+class LazyDfa
+{
+public:
+    // Constructors
+    LazyDfa(const std::shared_ptr<Graph> &,
+            const std::size_t &max_states = LAZY_DFA_DEFAULT_STATES);
+
+    // Destructor
+    ~LazyDfa() = default;
+
+    // Access Methods
+    const LazyDfaStats &get_stats() const;
+    std::size_t get_cached_state_count() const;
+    std::size_t get_max_states() const;
+    std::size_t get_memory_usage() const;
+
+    // Methods
+    bool match(std::string_view);
+    std::optional<std::size_t> find(std::string_view);
+    void reset_stats();
+
+private:
+    std::shared_ptr<Graph> m_nfa;
+    std::shared_ptr<const ClosureTable> m_closures;
+    ByteClasses m_classes;
+    std::vector<unsigned char> m_representatives;
+    std::size_t m_max_states;
+    int m_stride;
+
+    // Sets of NFA vertexes; the extra last bit marks unanchored states
+    int m_search_bit;
+    StateSet m_final;
+    StateSet m_start_set;
+    StateSet m_search_start_set;
+
+    // Cache
+    std::unordered_map<StateSet, int, StateSetHash> m_ids;
+    std::vector<StateSet> m_sets;
+    std::vector<int> m_transitions;
+    std::vector<bool> m_accepting;
+    int m_start;
+    int m_search_start;
+    LazyDfaStats m_stats;
+
+    // Scratch
+    StateSet m_moved;
+    StateSet m_next;
+
+    // Methods
+    int intern(const StateSet &);
+    int compute(const int &, const int &);
+    int get_start(const bool &);
+    void flush();
+};
+
+#endif //! LAZY_DFA_H
@@ -0,0 +1,824 @@
+/**
+ * @file matcher.cpp
+ * @author Carlos Salguero
+ * @brief Implementation of the Matcher class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+// C++ Standard Library
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <unordered_map>
+
+// Project files
+#include "matcher.h"
+#include "matcher_file.h"
+#include "../graph/state_set.h"
+
+// Structs
+/**
+ * @struct MatcherTables
+ * @brief Packed table of a Matcher and the ids of its rows, before they
+ * are copied into the image
+ */
+struct MatcherTables
+{
+    std::vector<std::uint32_t> table;
+    std::uint32_t start = 0;
+    std::uint32_t first_accepting = 0;
+    std::vector<std::int32_t> id_offsets;
+    std::vector<std::int32_t> ids;
+};
+
+// Functions
+/**
+ * @brief
+ * Packs a transition table so that the dead state is row 0, accepting
+ * states come last and every entry is premultiplied by the row length.
+ * @param rows Transitions per state and column, -1 for the dead state
+ * @param accepting Whether each state is accepting
+ * @param stride Number of columns per row
+ * @param start Start state
+ * @param table Packed table
+ * @param packed_start Packed start state
+ * @param first_accepting First packed accepting state
+ * @return std::vector<std::uint32_t> row of every state
+ */
+static std::vector<std::uint32_t> pack_table(
+    const std::vector<int> &rows, const std::vector<bool> &accepting,
+    const std::uint32_t &stride, const int &start,
+    std::vector<std::uint32_t> &table, std::uint32_t &packed_start,
+    std::uint32_t &first_accepting)
+{
+    const int states = static_cast<int>(accepting.size());
+    std::vector<std::uint32_t> order(states);
+    std::uint32_t next = 1;
+
+    for (int state = 0; state < states; state++)
+        if (!accepting[state])
+            order[state] = next++;
+
+    first_accepting = next * stride;
+
+    for (int state = 0; state < states; state++)
+        if (accepting[state])
+            order[state] = next++;
+
+    table.assign(static_cast<std::size_t>(next) * stride, 0);
+
+    for (int state = 0; state < states; state++)
+    {
+        std::uint32_t *row = table.data() + order[state] * stride;
+
+        for (std::uint32_t column = 0; column < stride; column++)
+        {
+            int target = rows[state * stride + column];
+
+            if (target >= 0)
+                row[column] = order[target] * stride;
+        }
+    }
+
+    packed_start = order[start] * stride;
+    return order;
+}
+
+/**
+ * @brief
+ * Packs the ids of every row into offsets and values
+ * @param ids Ids of every state
+ * @param order Row of every state
+ * @param offsets Offsets of the ids of every row
+ * @param values Ids of every row, one after the other
+ */
+static void pack_ids(const std::vector<std::vector<int>> &ids,
+                     const std::vector<std::uint32_t> &order,
+                     std::vector<std::int32_t> &offsets,
+                     std::vector<std::int32_t> &values)
+{
+    std::vector<const std::vector<int> *> rows(ids.size() + 1, nullptr);
+
+    for (std::size_t state = 0; state < ids.size(); state++)
+        rows[order[state]] = &ids[state];
+
+    offsets.assign(1, 0);
+    values.clear();
+
+    for (const std::vector<int> *row : rows)
+    {
+        if (row != nullptr)
+            values.insert(values.end(), row->begin(), row->end());
+
+        offsets.push_back(static_cast<std::int32_t>(values.size()));
+    }
+}
+
+/**
+ * @brief
+ * Builds the anchored table from the edges of the DFA
+ * @param dfa DFA to be compiled
+ * @param classes Byte classes of the DFA
+ * @param stride Number of columns per row
+ * @param tables Packed table
+ */
+static void build_table(const Graph &dfa, const ByteClasses &classes,
+                        const std::uint32_t &stride, MatcherTables &tables)
+{
+    const int states = dfa.get_next();
+
+    std::vector<int> rows(static_cast<std::size_t>(states) * stride, -1);
+    std::vector<bool> accepting(states, false);
+    std::vector<std::vector<int>> ids(states);
+
+    for (int state = 0; state < states; state++)
+    {
+        accepting[state] = dfa.is_final(state);
+        ids[state] = dfa.get_final_ids(state);
+
+        for (const Transition &transition : dfa.get_edges(state))
+        {
+            for (int byte = transition.low; byte <= transition.high; byte++)
+            {
+                int column =
+                    classes.get_class(static_cast<unsigned char>(byte));
+
+                rows[state * stride + column] = transition.to;
+            }
+        }
+    }
+
+    std::vector<std::uint32_t> order =
+        pack_table(rows, accepting, stride, dfa.get_start(), tables.table,
+                   tables.start, tables.first_accepting);
+
+    pack_ids(ids, order, tables.id_offsets, tables.ids);
+}
+
+/**
+ * @brief
+ * Builds the unanchored table. Each of its states is the set of DFA states
+ * alive after some prefix of the input, with the DFA start state injected
+ * at every position so that a match may begin anywhere.
+ * @param dfa DFA to be compiled
+ * @param classes Byte classes of the DFA
+ * @param stride Number of columns per row
+ * @param max_states Largest number of states of the table
+ * @param tables Packed table
+ * @throws std::length_error if the table needs more than max_states states
+ */
+static void build_search_table(const Graph &dfa, const ByteClasses &classes,
+                               const std::uint32_t &stride,
+                               const std::size_t &max_states,
+                               MatcherTables &tables)
+{
+    const int dfa_states = dfa.get_next();
+    const int start = dfa.get_start();
+
+    std::vector<int> delta(static_cast<std::size_t>(dfa_states) * stride, -1);
+
+    for (int state = 0; state < dfa_states; state++)
+    {
+        for (const Transition &transition : dfa.get_edges(state))
+        {
+            for (int byte = transition.low; byte <= transition.high; byte++)
+            {
+                int column =
+                    classes.get_class(static_cast<unsigned char>(byte));
+
+                delta[state * stride + column] = transition.to;
+            }
+        }
+    }
+
+    std::unordered_map<StateSet, int, StateSetHash> states;
+    std::vector<StateSet> subsets;
+    std::vector<int> rows;
+    std::vector<bool> accepting;
+    std::vector<std::vector<int>> ids;
+
+    auto add_state = [&](const StateSet &set)
+    {
+        if (subsets.size() == max_states)
+            throw std::length_error("the search table exceeds " +
+                                    std::to_string(max_states) + " states");
+
+        bool final = false;
+        std::vector<int> set_ids;
+
+        set.for_each([&](int state)
+                     {
+            if (!dfa.is_final(state))
+                return;
+
+            const std::vector<int> &state_ids = dfa.get_final_ids(state);
+
+            final = true;
+            set_ids.insert(set_ids.end(), state_ids.begin(),
+                           state_ids.end()); });
+
+        std::sort(set_ids.begin(), set_ids.end());
+        set_ids.erase(std::unique(set_ids.begin(), set_ids.end()),
+                      set_ids.end());
+
+        accepting.push_back(final);
+        ids.push_back(std::move(set_ids));
+        subsets.push_back(set);
+        rows.resize(subsets.size() * stride, -1);
+    };
+
+    StateSet initial(dfa_states);
+    initial.insert(start);
+
+    states.emplace(initial, 0);
+    add_state(initial);
+
+    StateSet next(dfa_states);
+
+    for (std::size_t current = 0; current < subsets.size(); current++)
+    {
+        for (std::uint32_t column = 0; column < stride; column++)
+        {
+            next.clear();
+            next.insert(start);
+
+            subsets[current].for_each([&](int state)
+                                      {
+                int target = delta[state * stride + column];
+
+                if (target >= 0)
+                    next.insert(target); });
+
+            auto [it, inserted] = states.try_emplace(
+                next, static_cast<int>(subsets.size()));
+
+            if (inserted)
+                add_state(next);
+
+            rows[current * stride + column] = it->second;
+        }
+    }
+
+    std::vector<std::uint32_t> order =
+        pack_table(rows, accepting, stride, 0, tables.table, tables.start,
+                   tables.first_accepting);
+
+    pack_ids(ids, order, tables.id_offsets, tables.ids);
+}
+
+/**
+ * @brief
+ * Checks that a buffer holds a compiled Matcher of this version, byte
+ * order and size, and that every section lies inside of it. The entries
+ * of the tables are checked by validate_table and validate_ids.
+ * @param image Buffer holding the file
+ * @return const MatcherFileHeader& header of the file
+ * @throws std::runtime_error if the buffer is not a valid file
+ */
+static const MatcherFileHeader &validate(std::span<const std::byte> image)
+{
+    if (image.size() < sizeof(MatcherFileHeader))
+        throw std::runtime_error("matcher file too small");
+
+    const MatcherFileHeader &header =
+        *reinterpret_cast<const MatcherFileHeader *>(image.data());
+
+    if (std::memcmp(header.magic, MATCHER_FILE_MAGIC,
+                    sizeof(MATCHER_FILE_MAGIC)) != 0)
+        throw std::runtime_error("not a matcher file");
+
+    if (header.version != MATCHER_FILE_VERSION)
+        throw std::runtime_error("unsupported matcher file version " +
+                                 std::to_string(header.version));
+
+    if (header.byte_order != MATCHER_FILE_BYTE_ORDER)
+        throw std::runtime_error("matcher file written with another byte "
+                                 "order");
+
+    if (header.file_size != image.size())
+        throw std::runtime_error("matcher file truncated");
+
+    for (int section = 0; section < SECTION_COUNT; section++)
+    {
+        const MatcherFileSectionEntry &entry = header.sections[section];
+
+        if (entry.offset % MATCHER_FILE_ALIGNMENT != 0 ||
+            entry.offset > image.size() ||
+            entry.count > (image.size() - entry.offset) /
+                              MATCHER_FILE_ELEMENT_SIZE[section])
+            throw std::runtime_error("matcher file section out of bounds");
+    }
+
+    const std::uint64_t stride = header.stride;
+
+    if (header.sections[SECTION_CLASSES].count != BYTE_VALUES ||
+        stride == 0 || stride > BYTE_VALUES ||
+        header.sections[SECTION_TABLE].count % stride != 0 ||
+        header.sections[SECTION_SEARCH_TABLE].count % stride != 0 ||
+        header.start >= header.sections[SECTION_TABLE].count ||
+        header.start % stride != 0 ||
+        header.search_start >= header.sections[SECTION_SEARCH_TABLE].count ||
+        header.search_start % stride != 0 ||
+        header.sections[SECTION_ID_OFFSETS].count !=
+            header.sections[SECTION_TABLE].count / stride + 1 ||
+        header.sections[SECTION_SEARCH_ID_OFFSETS].count !=
+            header.sections[SECTION_SEARCH_TABLE].count / stride + 1)
+        throw std::runtime_error("inconsistent matcher file");
+
+    const std::byte *classes =
+        image.data() + header.sections[SECTION_CLASSES].offset;
+
+    for (int byte = 0; byte < BYTE_VALUES; byte++)
+        if (static_cast<std::uint64_t>(classes[byte]) >= stride)
+            throw std::runtime_error("inconsistent matcher file");
+
+    return header;
+}
+
+/**
+ * @brief
+ * Get a section of an image as an array
+ * @param image Buffer holding a file written by Matcher::save
+ * @param header Validated header of the file
+ * @param section Section to be viewed
+ * @return std::span<const Element> elements of the section
+ */
+template <typename Element>
+static std::span<const Element> get_section(std::span<const std::byte> image,
+                                            const MatcherFileHeader &header,
+                                            const MatcherFileSection &section)
+{
+    const MatcherFileSectionEntry &entry = header.sections[section];
+
+    return std::span<const Element>(
+        reinterpret_cast<const Element *>(image.data() + entry.offset),
+        entry.count);
+}
+
+/**
+ * @brief
+ * Checks in one pass that every entry of a table is the start of one of
+ * its rows, so that stepping a mapped file never leaves the table
+ * @param table Packed table
+ * @param stride Number of columns per row
+ * @throws std::runtime_error if an entry is out of the table
+ */
+static void validate_table(std::span<const std::uint32_t> table,
+                           const std::uint32_t &stride)
+{
+    for (const std::uint32_t &entry : table)
+        if (entry >= table.size() || entry % stride != 0)
+            throw std::runtime_error("matcher file table out of bounds");
+}
+
+/**
+ * @brief
+ * Checks that the id offsets of a table are ordered, stay inside the ids,
+ * and that every id is non-negative
+ * @param offsets Offset of the ids of every row, and past the last one
+ * @param ids Ids of every row
+ * @throws std::runtime_error if an offset or an id is invalid
+ */
+static void validate_ids(std::span<const std::int32_t> offsets,
+                         std::span<const std::int32_t> ids)
+{
+    std::int64_t previous = 0;
+
+    for (const std::int32_t &offset : offsets)
+    {
+        if (offset < previous || static_cast<std::uint64_t>(offset) > ids.size())
+            throw std::runtime_error("matcher file ids out of bounds");
+
+        previous = offset;
+    }
+
+    for (const std::int32_t &id : ids)
+        if (id < 0)
+            throw std::runtime_error("matcher file ids out of bounds");
+}
+
+// Constructors
+/**
+ * @brief
+ * Construct a new Matcher:: Matcher object, compiling both tables into an
+ * owned image
+ * @param dfa DFA to be compiled, as returned by Automata::transform_dfa
+ * @param max_search_states Largest number of states of the unanchored
+ * table, which may be exponential in the size of the DFA, by default
+ * MATCHER_SEARCH_STATE_BUDGET
+ * @throws std::length_error if the unanchored table needs more states
+ */
+Matcher::Matcher(const Graph &dfa, const std::size_t &max_search_states)
+    : m_classes(dfa)
+{
+    const std::uint32_t stride = this->m_classes.get_class_count();
+
+    MatcherTables anchored;
+    MatcherTables search;
+
+    build_table(dfa, this->m_classes, stride, anchored);
+    build_search_table(dfa, this->m_classes, stride, max_search_states,
+                       search);
+
+    const void *data[SECTION_COUNT] = {
+        this->m_classes.get_classes().data(), anchored.table.data(),
+        anchored.id_offsets.data(), anchored.ids.data(),
+        search.table.data(), search.id_offsets.data(), search.ids.data()};
+
+    MatcherFileHeader header = {};
+    std::memcpy(header.magic, MATCHER_FILE_MAGIC, sizeof(MATCHER_FILE_MAGIC));
+    header.version = MATCHER_FILE_VERSION;
+    header.byte_order = MATCHER_FILE_BYTE_ORDER;
+    header.stride = stride;
+    header.start = anchored.start;
+    header.first_accepting = anchored.first_accepting;
+    header.search_start = search.start;
+    header.search_first_accepting = search.first_accepting;
+
+    header.sections[SECTION_CLASSES].count = BYTE_VALUES;
+    header.sections[SECTION_TABLE].count = anchored.table.size();
+    header.sections[SECTION_ID_OFFSETS].count = anchored.id_offsets.size();
+    header.sections[SECTION_IDS].count = anchored.ids.size();
+    header.sections[SECTION_SEARCH_TABLE].count = search.table.size();
+    header.sections[SECTION_SEARCH_ID_OFFSETS].count =
+        search.id_offsets.size();
+    header.sections[SECTION_SEARCH_IDS].count = search.ids.size();
+
+    std::uint64_t size = sizeof(MatcherFileHeader);
+
+    for (int section = 0; section < SECTION_COUNT; section++)
+    {
+        MatcherFileSectionEntry &entry = header.sections[section];
+
+        entry.offset = size;
+        size += entry.count * MATCHER_FILE_ELEMENT_SIZE[section];
+        size = (size + MATCHER_FILE_ALIGNMENT - 1) /
+               MATCHER_FILE_ALIGNMENT * MATCHER_FILE_ALIGNMENT;
+    }
+
+    header.file_size = size;
+
+    this->m_storage.assign(size / sizeof(std::uint64_t), 0);
+    std::byte *image = reinterpret_cast<std::byte *>(this->m_storage.data());
+
+    std::memcpy(image, &header, sizeof(header));
+
+    for (int section = 0; section < SECTION_COUNT; section++)
+        if (header.sections[section].count > 0)
+            std::memcpy(image + header.sections[section].offset,
+                        data[section],
+                        header.sections[section].count *
+                            MATCHER_FILE_ELEMENT_SIZE[section]);
+
+    this->view(std::span<const std::byte>(image, size));
+}
+
+/**
+ * @brief
+ * Construct a new Matcher:: Matcher object viewing a mapped file
+ * @param file Mapped file written by Matcher::save
+ */
+Matcher::Matcher(const std::shared_ptr<const MappedFile> &file)
+    : m_file(file)
+{
+    std::string_view data = this->m_file->get_data();
+
+    this->view(std::span<const std::byte>(
+        reinterpret_cast<const std::byte *>(data.data()), data.size()));
+}
+
+// Access Methods
+/**
+ * @brief
+ * Get the number of states of the anchored table, dead state included
+ * @return int number of states
+ */
+int Matcher::get_state_count() const
+{
+    return static_cast<int>(this->m_table.size() / this->m_stride);
+}
+
+/**
+ * @brief
+ * Get the number of states of the unanchored table, dead state included
+ * @return int number of states
+ */
+int Matcher::get_search_state_count() const
+{
+    return static_cast<int>(this->m_search_table.size() / this->m_stride);
+}
+
+/**
+ * @brief
+ * Get the number of byte classes, which is the length of a row
+ * @return int number of byte classes
+ */
+int Matcher::get_class_count() const
+{
+    return this->m_classes.get_class_count();
+}
+
+/**
+ * @brief
+ * Get the memory used by the image, holding both transition tables, and
+ * by the class map
+ * @return std::size_t size in bytes
+ */
+std::size_t Matcher::get_memory_usage() const
+{
+    return this->m_image.size() + sizeof(this->m_classes);
+}
+
+/**
+ * @brief
+ * Get the packed start state of the anchored table
+ * @return std::uint32_t start state
+ */
+std::uint32_t Matcher::get_start() const
+{
+    return this->m_start;
+}
+
+/**
+ * @brief
+ * Get the packed start state of the unanchored table
+ * @return std::uint32_t start state
+ */
+std::uint32_t Matcher::get_search_start() const
+{
+    return this->m_search_start;
+}
+
+/**
+ * @brief
+ * Get the image holding every table, in the format of matcher_file.h
+ * @return std::span<const std::byte> image
+ */
+std::span<const std::byte> Matcher::get_image() const
+{
+    return this->m_image;
+}
+
+/**
+ * @brief
+ * Checks if the tables are a mapping of a file rather than owned memory
+ * @return true if the matcher was loaded
+ */
+bool Matcher::is_mapped() const
+{
+    return this->m_file != nullptr;
+}
+
+// Methods (public)
+/**
+ * @brief
+ * Checks if the whole input belongs to the language of the DFA
+ * @param input Input to be matched
+ * @return true if the DFA accepts the input
+ */
+bool Matcher::match(std::string_view input) const
+{
+    constexpr std::size_t block = 64;
+
+    const std::uint32_t *table = this->m_table.data();
+    const std::uint8_t *classes = this->m_classes.get_classes().data();
+    const unsigned char *data =
+        reinterpret_cast<const unsigned char *>(input.data());
+    const std::size_t size = input.size();
+
+    std::uint32_t state = this->m_start;
+    std::size_t i = 0;
+
+    while (i + block <= size)
+    {
+        for (std::size_t j = 0; j < block; j++)
+            state = table[state + classes[data[i + j]]];
+
+        if (state == 0)
+            return false;
+
+        i += block;
+    }
+
+    for (; i < size; i++)
+        state = table[state + classes[data[i]]];
+
+    return state >= this->m_first_accepting;
+}
+
+/**
+ * @brief
+ * Searches the input for the first position where a match ends
+ * @param input Input to be searched
+ * @return std::optional<std::size_t> end offset of the earliest ending
+ * match, empty if there is no match
+ */
+std::optional<std::size_t> Matcher::find(std::string_view input) const
+{
+    const std::uint32_t *table = this->m_search_table.data();
+    const std::uint8_t *classes = this->m_classes.get_classes().data();
+    const unsigned char *data =
+        reinterpret_cast<const unsigned char *>(input.data());
+    const std::size_t size = input.size();
+    const std::uint32_t first_accepting = this->m_search_first_accepting;
+
+    std::uint32_t state = this->m_search_start;
+
+    if (state >= first_accepting)
+        return 0;
+
+    for (std::size_t i = 0; i < size; i++)
+    {
+        state = table[state + classes[data[i]]];
+
+        if (state >= first_accepting)
+            return i + 1;
+    }
+
+    return std::nullopt;
+}
+
+/**
+ * @brief
+ * Runs the whole input and reports the ids of the final state reached, such
+ * as the patterns of a PatternSet matching the whole input
+ * @param input Input to be matched
+ * @return std::vector<int> sorted ids, empty if the input is rejected
+ */
+std::vector<int> Matcher::match_ids(std::string_view input) const
+{
+    const std::uint32_t *table = this->m_table.data();
+    const std::uint8_t *classes = this->m_classes.get_classes().data();
+
+    std::uint32_t state = this->m_start;
+
+    for (const char &character : input)
+    {
+        state = table[state + classes[static_cast<unsigned char>(character)]];
+
+        if (state == 0)
+            return {};
+    }
+
+    if (state < this->m_first_accepting)
+        return {};
+
+    std::uint32_t row = state / this->m_stride;
+
+    return std::vector<int>(this->m_ids.begin() + this->m_id_offsets[row],
+                            this->m_ids.begin() + this->m_id_offsets[row + 1]);
+}
+
+/**
+ * @brief
+ * Scans the input once and reports the ids of every match found anywhere
+ * in it, such as every pattern of a PatternSet occurring in the input
+ * @param input Input to be scanned
+ * @return std::vector<int> sorted ids
+ */
+std::vector<int> Matcher::scan_ids(std::string_view input) const
+{
+    const std::uint32_t *table = this->m_search_table.data();
+    const std::uint8_t *classes = this->m_classes.get_classes().data();
+    const std::uint32_t first_accepting = this->m_search_first_accepting;
+
+    std::vector<bool> seen;
+    std::vector<int> ids;
+    std::uint32_t reported = 0;
+
+    auto report = [&](const std::uint32_t &state)
+    {
+        std::uint32_t row = state / this->m_stride;
+
+        for (int i = this->m_search_id_offsets[row];
+             i < this->m_search_id_offsets[row + 1]; i++)
+        {
+            int id = this->m_search_ids[i];
+
+            if (id >= static_cast<int>(seen.size()))
+                seen.resize(id + 1, false);
+
+            if (!seen[id])
+            {
+                seen[id] = true;
+                ids.push_back(id);
+            }
+        }
+
+        reported = state;
+    };
+
+    std::uint32_t state = this->m_search_start;
+
+    if (state >= first_accepting)
+        report(state);
+
+    for (const char &character : input)
+    {
+        state = table[state + classes[static_cast<unsigned char>(character)]];
+
+        if (state >= first_accepting && state != reported)
+            report(state);
+    }
+
+    std::sort(ids.begin(), ids.end());
+    return ids;
+}
+
+/**
+ * @brief
+ * Writes the image to a file. The file is written next to its final path
+ * and renamed, so processes mapping the old file keep a consistent copy.
+ * The temporary file is removed if either step fails.
+ * @param path Path of the file
+ * @throws std::runtime_error if the file cannot be written
+ * @throws std::filesystem::filesystem_error if it cannot be renamed
+ */
+void Matcher::save(const std::string &path) const
+{
+    const std::string temporary = path + ".tmp";
+
+    try
+    {
+        {
+            std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+
+            file.write(reinterpret_cast<const char *>(this->m_image.data()),
+                       static_cast<std::streamsize>(this->m_image.size()));
+
+            if (!file.flush())
+                throw std::runtime_error("cannot write " + temporary);
+        }
+
+        std::filesystem::rename(temporary, path);
+    }
+
+    catch (...)
+    {
+        std::error_code ignored;
+        std::filesystem::remove(temporary, ignored);
+        throw;
+    }
+}
+
+/**
+ * @brief
+ * Maps a file written by save. The tables are checked in one pass and
+ * then used in place.
+ * @param path Path of the file
+ * @return Matcher matcher viewing the file
+ * @throws std::system_error if the file cannot be mapped
+ * @throws std::runtime_error if the file is not a valid matcher file
+ */
+Matcher Matcher::load(const std::string &path)
+{
+    return Matcher(std::make_shared<const MappedFile>(path));
+}
+
+// Methods (private)
+/**
+ * @brief
+ * Points every table into an image
+ * @param image Buffer holding a file written by save
+ */
+void Matcher::view(std::span<const std::byte> image)
+{
+    const MatcherFileHeader &header = validate(image);
+
+    std::array<std::uint8_t, BYTE_VALUES> classes;
+    std::memcpy(classes.data(), image.data() +
+                                    header.sections[SECTION_CLASSES].offset,
+                BYTE_VALUES);
+
+    this->m_classes = ByteClasses(classes);
+    this->m_stride = header.stride;
+    this->m_image = image;
+
+    this->m_table = get_section<std::uint32_t>(image, header, SECTION_TABLE);
+    this->m_start = header.start;
+    this->m_first_accepting = header.first_accepting;
+    this->m_id_offsets =
+        get_section<std::int32_t>(image, header, SECTION_ID_OFFSETS);
+    this->m_ids = get_section<std::int32_t>(image, header, SECTION_IDS);
+
+    this->m_search_table =
+        get_section<std::uint32_t>(image, header, SECTION_SEARCH_TABLE);
+    this->m_search_start = header.search_start;
+    this->m_search_first_accepting = header.search_first_accepting;
+    this->m_search_id_offsets =
+        get_section<std::int32_t>(image, header, SECTION_SEARCH_ID_OFFSETS);
+    this->m_search_ids =
+        get_section<std::int32_t>(image, header, SECTION_SEARCH_IDS);
+
+    validate_table(this->m_table, this->m_stride);
+    validate_table(this->m_search_table, this->m_stride);
+    validate_ids(this->m_id_offsets, this->m_ids);
+    validate_ids(this->m_search_id_offsets, this->m_search_ids);
+}
@@ -0,0 +1,162 @@
+/**
+ * @file matcher.h
+ * @author Carlos Salguero
+ * @brief Declaration of the Matcher class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef MATCHER_H
+#define MATCHER_H
+
+// C++ Standard Library
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Project files
+#include "../graph/graph.h"
+#include "../automata/byte_classes.h"
+#include "../io/mapped_file.h"
+
+// Constants
+constexpr std::size_t MATCHER_SEARCH_STATE_BUDGET = 65536;
+
+// Class
+/**
+ * @class Matcher
+ * @brief Compiled DFA stored as a dense transition table.
+ *
+ * Rows are indexed by byte class. States are stored premultiplied by the
+ * row length, the dead state is row 0 and accepting states are numbered
+ * last, so a step is two loads and acceptance is one comparison.
+ *
+ * The tables live in one image laid out as described in matcher_file.h.
+ * A compiled matcher owns its image; a loaded one views a read-only
+ * mapping of the file, so loading copies nothing and every process
+ * mapping the same file shares its pages. Loading reads every entry once
+ * to check it stays inside its table, so a corrupted file is rejected
+ * rather than stepped out of bounds.
+ */
+class Matcher
+{
+public:
+    // Constructors
+    Matcher(const Graph &,
+            const std::size_t &max_search_states = MATCHER_SEARCH_STATE_BUDGET);
+    Matcher(const Matcher &) = delete;
+    Matcher(Matcher &&) = default;
+
+    // Destructor
+    ~Matcher() = default;
+
+    // Operators
+    Matcher &operator=(const Matcher &) = delete;
+    Matcher &operator=(Matcher &&) = default;
+
+    // Access Methods
+    int get_state_count() const;
+    int get_search_state_count() const;
+    int get_class_count() const;
+    std::size_t get_memory_usage() const;
+    std::uint32_t get_start() const;
+    std::uint32_t get_search_start() const;
+    std::span<const std::byte> get_image() const;
+    bool is_mapped() const;
+
+    // Methods
+    bool match(std::string_view) const;
+    std::optional<std::size_t> find(std::string_view) const;
+    std::vector<int> match_ids(std::string_view) const;
+    std::vector<int> scan_ids(std::string_view) const;
+
+    void save(const std::string &) const;
+    static Matcher load(const std::string &);
+
+    /**
+     * @brief
+     * Steps the anchored table, for callers that keep their own state
+     * @param state packed state, 0 is the dead state
+     * @param byte input byte
+     * @return std::uint32_t packed next state
+     */
+    std::uint32_t step(const std::uint32_t &state,
+                       const unsigned char &byte) const
+    {
+        return this->m_table[state + this->m_classes.get_class(byte)];
+    }
+
+    /**
+     * @brief
+     * Checks if a packed state of the anchored table is accepting
+     * @param state packed state
+     * @return true if the state is accepting
+     */
+    bool is_accepting(const std::uint32_t &state) const
+    {
+        return state >= this->m_first_accepting;
+    }
+
+    /**
+     * @brief
+     * Steps the unanchored table, for callers that keep their own state
+     * @param state packed state of the unanchored table
+     * @param byte input byte
+     * @return std::uint32_t packed next state
+     */
+    std::uint32_t search_step(const std::uint32_t &state,
+                              const unsigned char &byte) const
+    {
+        return this->m_search_table[state + this->m_classes.get_class(byte)];
+    }
+
+    /**
+     * @brief
+     * Checks if a packed state of the unanchored table is accepting
+     * @param state packed state
+     * @return true if a match ends on the state
+     */
+    bool is_search_accepting(const std::uint32_t &state) const
+    {
+        return state >= this->m_search_first_accepting;
+    }
+
+private:
+    ByteClasses m_classes;
+    std::uint32_t m_stride;
+
+    // Image holding every table, owned or mapped
+    std::vector<std::uint64_t> m_storage;
+    std::shared_ptr<const MappedFile> m_file;
+    std::span<const std::byte> m_image;
+
+    // Anchored table, one row per DFA state plus the dead state
+    std::span<const std::uint32_t> m_table;
+    std::uint32_t m_start;
+    std::uint32_t m_first_accepting;
+    std::span<const std::int32_t> m_id_offsets;
+    std::span<const std::int32_t> m_ids;
+
+    // Unanchored table, one row per set of DFA states alive while searching
+    std::span<const std::uint32_t> m_search_table;
+    std::uint32_t m_search_start;
+    std::uint32_t m_search_first_accepting;
+    std::span<const std::int32_t> m_search_id_offsets;
+    std::span<const std::int32_t> m_search_ids;
+
+    // Constructors
+    Matcher(const std::shared_ptr<const MappedFile> &);
+
+    // Methods
+    void view(std::span<const std::byte>);
+};
+
+#endif //! MATCHER_H
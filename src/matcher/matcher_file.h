@@ -0,0 +1,87 @@
+/**
+ * @file matcher_file.h
+ * @author Carlos Salguero
+ * @brief Binary format of a compiled Matcher
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef MATCHER_FILE_H
+#define MATCHER_FILE_H
+
+// C++ Standard Library
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+// Constants
+constexpr char MATCHER_FILE_MAGIC[8] = {'R', 'E', 'G', 'X', 'D', 'F', 'A', 0};
+constexpr std::uint32_t MATCHER_FILE_VERSION = 1;
+constexpr std::uint32_t MATCHER_FILE_BYTE_ORDER = 0x01020304;
+constexpr std::size_t MATCHER_FILE_ALIGNMENT = 8;
+
+// Enums
+/**
+ * @enum MatcherFileSection
+ * @brief Arrays stored after the header, in file order
+ */
+enum MatcherFileSection
+{
+    SECTION_CLASSES,
+    SECTION_TABLE,
+    SECTION_ID_OFFSETS,
+    SECTION_IDS,
+    SECTION_SEARCH_TABLE,
+    SECTION_SEARCH_ID_OFFSETS,
+    SECTION_SEARCH_IDS,
+    SECTION_COUNT
+};
+
+/**
+ * @brief Size in bytes of one element of every section: the byte classes
+ * are bytes, the tables packed states and the ids 32-bit integers
+ */
+constexpr std::size_t MATCHER_FILE_ELEMENT_SIZE[SECTION_COUNT] = {1, 4, 4, 4,
+                                                                  4, 4, 4};
+
+// Structs
+/**
+ * @struct MatcherFileSectionEntry
+ * @brief Location of a section, its offset is a multiple of
+ * MATCHER_FILE_ALIGNMENT from the start of the file
+ */
+struct MatcherFileSectionEntry
+{
+    std::uint64_t offset;
+    std::uint64_t count;
+};
+
+/**
+ * @struct MatcherFileHeader
+ * @brief First bytes of a compiled Matcher file. Every field is stored in
+ * the byte order of the machine that wrote it, which byte_order tells.
+ */
+struct MatcherFileHeader
+{
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t byte_order;
+    std::uint64_t file_size;
+
+    std::uint32_t stride;
+    std::uint32_t start;
+    std::uint32_t first_accepting;
+    std::uint32_t search_start;
+    std::uint32_t search_first_accepting;
+    std::uint32_t reserved;
+
+    MatcherFileSectionEntry sections[SECTION_COUNT];
+};
+
+static_assert(std::is_trivially_copyable_v<MatcherFileHeader>);
+static_assert(sizeof(MatcherFileHeader) % MATCHER_FILE_ALIGNMENT == 0);
+
+#endif //! MATCHER_FILE_H
@@ -0,0 +1,357 @@
+/**
+ * @file parallel_scanner.cpp
+ * @author Carlos Salguero
+ * @brief Implementation of the ParallelScanner class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+// C++ Standard Library
+#include <algorithm>
+#include <thread>
+
+// Project files
+#include "parallel_scanner.h"
+
+// Functions
+/**
+ * @brief
+ * Runs a task once per index, each on its own thread, the first one on the
+ * calling thread
+ * @param size Number of indexes
+ * @param task Task taking an index
+ */
+template <typename Task>
+static void parallel_for(const std::size_t &size, const Task &task)
+{
+    std::vector<std::thread> workers;
+    workers.reserve(size);
+
+    for (std::size_t i = 1; i < size; i++)
+        workers.emplace_back(task, i);
+
+    if (size > 0)
+        task(std::size_t(0));
+
+    for (std::thread &worker : workers)
+        worker.join();
+}
+
+// Constructors
+/**
+ * @brief
+ * Construct a new ParallelScanner:: ParallelScanner object
+ * @param matcher Compiled DFA, shared with other matchers
+ * @param threads Maximum number of threads, 0 for one per core
+ * @param strategy How chunks are scanned before their start state is known
+ * @param min_chunk Smallest chunk worth its own thread
+ */
+ParallelScanner::ParallelScanner(const std::shared_ptr<const Matcher> &matcher,
+                                 const unsigned &threads,
+                                 const ParallelStrategy &strategy,
+                                 const std::size_t &min_chunk)
+    : m_matcher(matcher), m_threads(threads), m_strategy(strategy),
+      m_min_chunk(std::max<std::size_t>(min_chunk, 1))
+{
+    if (this->m_threads == 0)
+        this->m_threads = std::max(1u, std::thread::hardware_concurrency());
+
+    if (this->m_strategy == ParallelStrategy::AUTO)
+        this->m_strategy = this->m_matcher->get_search_state_count() - 1 <=
+                                   PARALLEL_ENUMERATE_MAX_STATES
+                               ? ParallelStrategy::ENUMERATE
+                               : ParallelStrategy::SPECULATE;
+}
+
+// Access Methods
+/**
+ * @brief
+ * Get the maximum number of threads
+ * @return unsigned number of threads
+ */
+unsigned ParallelScanner::get_thread_count() const
+{
+    return this->m_threads;
+}
+
+/**
+ * @brief
+ * Get the strategy in use, AUTO already resolved
+ * @return ParallelStrategy strategy
+ */
+ParallelStrategy ParallelScanner::get_strategy() const
+{
+    return this->m_strategy;
+}
+
+// Methods (public)
+/**
+ * @brief
+ * Finds every offset where a match ends, as Matcher::find would report
+ * them one after the other
+ * @param input Input to be searched
+ * @return std::vector<std::size_t> end offsets, in increasing order
+ */
+std::vector<std::size_t> ParallelScanner::scan(std::string_view input) const
+{
+    std::vector<Chunk> chunks;
+    this->scan_chunks(input, true, chunks);
+
+    std::size_t total = 0;
+    for (const Chunk &chunk : chunks)
+        total += chunk.ends.size();
+
+    std::vector<std::size_t> ends;
+    ends.reserve(total);
+
+    for (const Chunk &chunk : chunks)
+        ends.insert(ends.end(), chunk.ends.begin(), chunk.ends.end());
+
+    return ends;
+}
+
+/**
+ * @brief
+ * Counts the offsets where a match ends, without keeping them
+ * @param input Input to be searched
+ * @return std::size_t number of match ends
+ */
+std::size_t ParallelScanner::count(std::string_view input) const
+{
+    std::vector<Chunk> chunks;
+    this->scan_chunks(input, false, chunks);
+
+    std::size_t total = 0;
+    for (const Chunk &chunk : chunks)
+        total += chunk.count;
+
+    return total;
+}
+
+// Methods (private)
+/**
+ * @brief
+ * Splits the input into chunks and scans them with the chosen strategy
+ * @param input Input to be searched
+ * @param record Whether to keep the end offsets
+ * @param chunks Scanned chunks, in input order
+ */
+void ParallelScanner::scan_chunks(std::string_view input, const bool &record,
+                                  std::vector<Chunk> &chunks) const
+{
+    std::size_t count = std::min<std::size_t>(
+        this->m_threads, std::max<std::size_t>(1, input.size() /
+                                                      this->m_min_chunk));
+
+    chunks.assign(count, Chunk());
+
+    for (std::size_t i = 0; i < count; i++)
+    {
+        chunks[i].begin = input.size() * i / count;
+        chunks[i].end = input.size() * (i + 1) / count;
+    }
+
+    chunks[0].entry = this->m_matcher->get_search_start();
+
+    if (count == 1)
+        chunks[0].exit = this->run(input, chunks[0].begin, chunks[0].end,
+                                   chunks[0].entry, record, chunks[0], false);
+
+    else if (this->m_strategy == ParallelStrategy::ENUMERATE)
+        this->enumerate(input, record, chunks);
+
+    else
+        this->speculate(input, record, chunks);
+}
+
+/**
+ * @brief
+ * Scans a range of the input, adding its matches to a chunk
+ * @param input Input to be searched
+ * @param begin First offset of the range
+ * @param end Offset past the range
+ * @param state State the range starts in
+ * @param record Whether to keep the end offsets
+ * @param chunk Chunk the matches are added to
+ * @param checkpoints Whether to keep the state every PARALLEL_CHECKPOINT
+ * bytes from the beginning of the chunk
+ * @return std::uint32_t state at the end of the range
+ */
+std::uint32_t ParallelScanner::run(std::string_view input,
+                                   const std::size_t &begin,
+                                   const std::size_t &end,
+                                   std::uint32_t state, const bool &record,
+                                   Chunk &chunk,
+                                   const bool &checkpoints) const
+{
+    const Matcher &matcher = *this->m_matcher;
+    const unsigned char *data =
+        reinterpret_cast<const unsigned char *>(input.data());
+
+    std::size_t position = begin;
+
+    while (position < end)
+    {
+        std::size_t stop = end;
+
+        if (checkpoints)
+            stop = std::min(end, chunk.begin +
+                                     ((position - chunk.begin) /
+                                          PARALLEL_CHECKPOINT +
+                                      1) *
+                                         PARALLEL_CHECKPOINT);
+
+        for (; position < stop; position++)
+        {
+            state = matcher.search_step(state, data[position]);
+
+            if (matcher.is_search_accepting(state))
+            {
+                chunk.count++;
+
+                if (record)
+                    chunk.ends.push_back(position + 1);
+            }
+        }
+
+        if (checkpoints && stop < end)
+            chunk.checkpoints.push_back({state, chunk.count});
+    }
+
+    return state;
+}
+
+/**
+ * @brief
+ * Runs every chunk but the first from every state at once, chains the real
+ * start states and scans every chunk from its own
+ * @param input Input to be searched
+ * @param record Whether to keep the end offsets
+ * @param chunks Chunks to be scanned
+ */
+void ParallelScanner::enumerate(std::string_view input, const bool &record,
+                                std::vector<Chunk> &chunks) const
+{
+    const Matcher &matcher = *this->m_matcher;
+    const std::uint32_t stride = matcher.get_class_count();
+    const std::uint32_t rows = matcher.get_search_state_count();
+    const unsigned char *data =
+        reinterpret_cast<const unsigned char *>(input.data());
+
+    // exits[i][row] is the state chunk i ends in when it starts in row
+    std::vector<std::vector<std::uint32_t>> exits(chunks.size());
+
+    parallel_for(chunks.size(), [&](std::size_t i)
+                 {
+        Chunk &chunk = chunks[i];
+
+        if (i == 0)
+        {
+            chunk.exit = this->run(input, chunk.begin, chunk.end,
+                                   chunk.entry, record, chunk, false);
+            return;
+        }
+
+        // Only the state the last chunk ends in is never needed
+        if (i + 1 == chunks.size())
+            return;
+
+        std::vector<std::uint32_t> &lanes = exits[i];
+        lanes.resize(rows);
+
+        for (std::uint32_t row = 0; row < rows; row++)
+            lanes[row] = row * stride;
+
+        for (std::size_t position = chunk.begin; position < chunk.end;
+             position++)
+            for (std::uint32_t &lane : lanes)
+                lane = matcher.search_step(lane, data[position]); });
+
+    for (std::size_t i = 1; i < chunks.size(); i++)
+    {
+        chunks[i].entry = chunks[i - 1].exit;
+
+        if (i + 1 < chunks.size())
+            chunks[i].exit = exits[i][chunks[i].entry / stride];
+    }
+
+    parallel_for(chunks.size() - 1, [&](std::size_t i)
+                 {
+        Chunk &chunk = chunks[i + 1];
+        chunk.exit = this->run(input, chunk.begin, chunk.end, chunk.entry,
+                               record, chunk, false); });
+}
+
+/**
+ * @brief
+ * Scans every chunk from the start state, then fixes the chunks whose real
+ * start state differs by scanning them again until the runs converge
+ * @param input Input to be searched
+ * @param record Whether to keep the end offsets
+ * @param chunks Chunks to be scanned
+ */
+void ParallelScanner::speculate(std::string_view input, const bool &record,
+                                std::vector<Chunk> &chunks) const
+{
+    const std::uint32_t start = this->m_matcher->get_search_start();
+
+    parallel_for(chunks.size(), [&](std::size_t i)
+                 {
+        Chunk &chunk = chunks[i];
+
+        chunk.entry = start;
+        chunk.exit = this->run(input, chunk.begin, chunk.end, start, record,
+                               chunk, i > 0); });
+
+    for (std::size_t i = 1; i < chunks.size(); i++)
+    {
+        Chunk &chunk = chunks[i];
+        const std::uint32_t entry = chunks[i - 1].exit;
+
+        if (entry == chunk.entry)
+            continue;
+
+        Chunk fixed;
+        fixed.begin = chunk.begin;
+        fixed.end = chunk.end;
+        fixed.entry = entry;
+
+        std::uint32_t state = entry;
+        std::size_t position = chunk.begin;
+        bool converged = false;
+
+        for (const Checkpoint &checkpoint : chunk.checkpoints)
+        {
+            std::size_t stop = position + PARALLEL_CHECKPOINT;
+
+            state = this->run(input, position, stop, state, record, fixed,
+                              false);
+            position = stop;
+
+            if (state == checkpoint.state)
+            {
+                fixed.count += chunk.count - checkpoint.count;
+                fixed.exit = chunk.exit;
+
+                if (record)
+                    fixed.ends.insert(
+                        fixed.ends.end(),
+                        std::upper_bound(chunk.ends.begin(), chunk.ends.end(),
+                                         position),
+                        chunk.ends.end());
+
+                converged = true;
+                break;
+            }
+        }
+
+        if (!converged)
+            fixed.exit = this->run(input, position, chunk.end, state, record,
+                                   fixed, false);
+
+        chunk = std::move(fixed);
+    }
+}
@@ -0,0 +1,119 @@
+/**
+ * @file parallel_scanner.h
+ * @author Carlos Salguero
+ * @brief Declaration of the ParallelScanner class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef PARALLEL_SCANNER_H
+#define PARALLEL_SCANNER_H
+
+// C++ Standard Library
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+// Project files
+#include "matcher.h"
+
+// Constants
+constexpr int PARALLEL_ENUMERATE_MAX_STATES = 16;
+constexpr std::size_t PARALLEL_MIN_CHUNK = 1 << 16;
+constexpr std::size_t PARALLEL_CHECKPOINT = 1 << 12;
+
+// Enums
+/**
+ * @enum ParallelStrategy
+ * @brief How a chunk is scanned before the state it starts in is known
+ */
+enum class ParallelStrategy
+{
+    AUTO,
+    ENUMERATE,
+    SPECULATE
+};
+
+// Class
+/**
+ * @class ParallelScanner
+ * @brief Unanchored search of a large input split into one chunk per thread.
+ *
+ * A chunk does not know the DFA state it starts in until every chunk before
+ * it is scanned. With ENUMERATE, each chunk is first run from every state
+ * of the unanchored table at once, the real start states are chained from
+ * those runs and each chunk is scanned again from its own. With SPECULATE,
+ * each chunk is scanned from the start state, keeping its state every
+ * PARALLEL_CHECKPOINT bytes; a wrong guess is fixed by scanning again from
+ * the real state until it meets the speculative run at a checkpoint. AUTO
+ * enumerates for tables of at most PARALLEL_ENUMERATE_MAX_STATES states.
+ */
+class ParallelScanner
+{
+public:
+    // Constructors
+    ParallelScanner(const std::shared_ptr<const Matcher> &,
+                    const unsigned &threads = 0,
+                    const ParallelStrategy &strategy = ParallelStrategy::AUTO,
+                    const std::size_t &min_chunk = PARALLEL_MIN_CHUNK);
+
+    // Destructor
+    ~ParallelScanner() = default;
+
+    // Access Methods
+    unsigned get_thread_count() const;
+    ParallelStrategy get_strategy() const;
+
+    // Methods
+    std::vector<std::size_t> scan(std::string_view) const;
+    std::size_t count(std::string_view) const;
+
+private:
+    /**
+     * @struct Checkpoint
+     * @brief State of a speculative run and the matches found before it
+     */
+    struct Checkpoint
+    {
+        std::uint32_t state;
+        std::size_t count;
+    };
+
+    /**
+     * @struct Chunk
+     * @brief Slice of the input and the result of scanning it
+     */
+    struct Chunk
+    {
+        std::size_t begin = 0;
+        std::size_t end = 0;
+        std::uint32_t entry = 0;
+        std::uint32_t exit = 0;
+        std::size_t count = 0;
+        std::vector<std::size_t> ends;
+        std::vector<Checkpoint> checkpoints;
+    };
+
+    std::shared_ptr<const Matcher> m_matcher;
+    unsigned m_threads;
+    ParallelStrategy m_strategy;
+    std::size_t m_min_chunk;
+
+    // Methods
+    void scan_chunks(std::string_view, const bool &,
+                     std::vector<Chunk> &) const;
+    std::uint32_t run(std::string_view, const std::size_t &,
+                      const std::size_t &, std::uint32_t, const bool &,
+                      Chunk &, const bool &) const;
+    void enumerate(std::string_view, const bool &,
+                   std::vector<Chunk> &) const;
+    void speculate(std::string_view, const bool &,
+                   std::vector<Chunk> &) const;
+};
+
+#endif //! PARALLEL_SCANNER_H
@@ -0,0 +1,226 @@
+/**
+ * @file prefilter.cpp
+ * @author Carlos Salguero
+ * @brief Implementation of the Prefilter class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+// C++ Standard Library
+#include <cstring>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define PREFILTER_X86 1
+#include <immintrin.h>
+#endif
+
+// Project files
+#include "prefilter.h"
+
+// Functions
+/**
+ * @brief
+ * Searches a literal with memchr on its first byte
+ * @param haystack Input
+ * @param size Length of the input
+ * @param needle Literal, at least one byte long
+ * @param length Length of the literal
+ * @return std::size_t offset of the first occurrence, npos if there is none
+ */
+static std::size_t search_scalar(const char *haystack, std::size_t size,
+                                 const char *needle, std::size_t length)
+{
+    std::size_t position = 0;
+
+    while (position + length <= size)
+    {
+        const void *found = std::memchr(haystack + position, needle[0],
+                                        size - length + 1 - position);
+
+        if (found == nullptr)
+            break;
+
+        position = static_cast<const char *>(found) - haystack;
+
+        if (std::memcmp(haystack + position + 1, needle + 1, length - 1) == 0)
+            return position;
+
+        position++;
+    }
+
+    return std::string_view::npos;
+}
+
+#ifdef PREFILTER_X86
+/**
+ * @brief
+ * Checks the candidates of a block given by a mask of matching ends
+ * @param haystack Input
+ * @param position Offset of the block
+ * @param mask Bit i is set if the literal can start at position + i
+ * @param needle Literal
+ * @param length Length of the literal
+ * @return std::size_t offset of the first occurrence, npos if there is none
+ */
+static std::size_t verify(const char *haystack, std::size_t position,
+                          unsigned mask, const char *needle,
+                          std::size_t length)
+{
+    while (mask != 0)
+    {
+        std::size_t candidate = position + __builtin_ctz(mask);
+
+        if (std::memcmp(haystack + candidate + 1, needle + 1, length - 2) == 0)
+            return candidate;
+
+        mask &= mask - 1;
+    }
+
+    return std::string_view::npos;
+}
+
+/**
+ * @brief
+ * Searches a literal of two bytes or more, sixteen positions at a time
+ * @param haystack Input
+ * @param size Length of the input
+ * @param needle Literal
+ * @param length Length of the literal
+ * @return std::size_t offset of the first occurrence, npos if there is none
+ */
+static std::size_t search_sse2(const char *haystack, std::size_t size,
+                               const char *needle, std::size_t length)
+{
+    const __m128i first = _mm_set1_epi8(needle[0]);
+    const __m128i last = _mm_set1_epi8(needle[length - 1]);
+    std::size_t position = 0;
+
+    for (; position + length - 1 + 16 <= size; position += 16)
+    {
+        __m128i head = _mm_loadu_si128(
+            reinterpret_cast<const __m128i *>(haystack + position));
+        __m128i tail = _mm_loadu_si128(
+            reinterpret_cast<const __m128i *>(haystack + position + length - 1));
+
+        unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(
+            _mm_and_si128(_mm_cmpeq_epi8(head, first),
+                          _mm_cmpeq_epi8(tail, last))));
+
+        std::size_t found = verify(haystack, position, mask, needle, length);
+
+        if (found != std::string_view::npos)
+            return found;
+    }
+
+    std::size_t found = search_scalar(haystack + position, size - position,
+                                      needle, length);
+
+    return found == std::string_view::npos ? found : position + found;
+}
+
+/**
+ * @brief
+ * Searches a literal of two bytes or more, thirty-two positions at a time
+ * @param haystack Input
+ * @param size Length of the input
+ * @param needle Literal
+ * @param length Length of the literal
+ * @return std::size_t offset of the first occurrence, npos if there is none
+ */
+__attribute__((target("avx2"))) static std::size_t
+search_avx2(const char *haystack, std::size_t size, const char *needle,
+            std::size_t length)
+{
+    const __m256i first = _mm256_set1_epi8(needle[0]);
+    const __m256i last = _mm256_set1_epi8(needle[length - 1]);
+    std::size_t position = 0;
+
+    for (; position + length - 1 + 32 <= size; position += 32)
+    {
+        __m256i head = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i *>(haystack + position));
+        __m256i tail = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i *>(haystack + position + length - 1));
+
+        unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(
+            _mm256_and_si256(_mm256_cmpeq_epi8(head, first),
+                             _mm256_cmpeq_epi8(tail, last))));
+
+        std::size_t found = verify(haystack, position, mask, needle, length);
+
+        if (found != std::string_view::npos)
+            return found;
+    }
+
+    std::size_t found = search_scalar(haystack + position, size - position,
+                                      needle, length);
+
+    return found == std::string_view::npos ? found : position + found;
+}
+#endif
+
+// Constructors
+/**
+ * @brief
+ * Construct a new Prefilter:: Prefilter object, picking the widest search
+ * the processor supports
+ * @param literal Literal every match contains, may be empty
+ */
+Prefilter::Prefilter(const std::string &literal)
+    : m_literal(literal), m_search(search_scalar)
+{
+#ifdef PREFILTER_X86
+    if (literal.size() >= 2)
+        this->m_search = __builtin_cpu_supports("avx2") ? search_avx2
+                                                        : search_sse2;
+#endif
+}
+
+// Access Methods
+/**
+ * @brief
+ * Get the literal searched for
+ * @return const std::string& literal
+ */
+const std::string &Prefilter::get_literal() const
+{
+    return this->m_literal;
+}
+
+/**
+ * @brief
+ * Checks if the prefilter has no literal, so every position is a candidate
+ * @return true if the literal is empty
+ */
+bool Prefilter::is_empty() const
+{
+    return this->m_literal.empty();
+}
+
+// Methods
+/**
+ * @brief
+ * Finds the next occurrence of the literal
+ * @param input Input to be searched
+ * @param from Offset the search starts at
+ * @return std::size_t offset of the occurrence, npos if there is none. An
+ * empty literal occurs at every offset.
+ */
+std::size_t Prefilter::find(std::string_view input, std::size_t from) const
+{
+    if (from > input.size())
+        return std::string_view::npos;
+
+    if (this->m_literal.empty())
+        return from;
+
+    std::size_t found = this->m_search(input.data() + from,
+                                       input.size() - from,
+                                       this->m_literal.data(),
+                                       this->m_literal.size());
+
+    return found == std::string_view::npos ? found : from + found;
+}
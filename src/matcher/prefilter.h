@@ -0,0 +1,54 @@
+/**
+ * @file prefilter.h
+ * @author Carlos Salguero
+ * @brief Declaration of the Prefilter class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef PREFILTER_H
+#define PREFILTER_H
+
+// C++ Standard Library
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+// Class
+/**
+ * @class Prefilter
+ * @brief Vectorized search for a literal every match must contain.
+ *
+ * Candidates are found by comparing the first and the last byte of the
+ * literal against a whole vector of the input at once and checking the
+ * rest only where both agree. AVX2 is used when the processor has it,
+ * SSE2 on every other x86-64 processor and memchr elsewhere.
+ */
+class Prefilter
+{
+public:
+    // Constructors
+    Prefilter(const std::string &);
+
+    // Destructor
+    ~Prefilter() = default;
+
+    // Access Methods
+    const std::string &get_literal() const;
+    bool is_empty() const;
+
+    // Methods
+    std::size_t find(std::string_view, std::size_t = 0) const;
+
+private:
+    using Search = std::size_t (*)(const char *, std::size_t,
+                                   const char *, std::size_t);
+
+    std::string m_literal;
+    Search m_search;
+};
+
+#endif //! PREFILTER_H
@@ -0,0 +1,146 @@
+/**
+ * @file span_matcher.cpp
+ * @author Carlos Salguero
+ * @brief Implementation of the SpanMatcher class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+// Project files
+#include "span_matcher.h"
+#include "../automata/automata.h"
+#include "../automata/byte_classes.h"
+#include "../automata/minimizer.h"
+
+// Functions
+/**
+ * @brief
+ * Compiles an NFA into the matcher of its minimal DFA
+ * @param nfa NFA to be compiled
+ * @param max_states Largest number of states of either table
+ * @return Matcher compiled DFA
+ * @throws std::length_error if a table needs more than max_states states
+ */
+static Matcher compile(const Graph &nfa, const std::size_t &max_states)
+{
+    Minimizer minimizer;
+
+    return Matcher(*minimizer.minimize(*Automata::determinize(
+                       nfa, ByteClasses(nfa), max_states)),
+                   max_states);
+}
+
+// Constructors
+/**
+ * @brief
+ * Construct a new SpanMatcher:: SpanMatcher object, compiling the DFAs of
+ * an NFA and of its reverse
+ * @param nfa Thompson NFA of the expression
+ * @param max_states Largest number of states of any table
+ * @throws std::length_error if a table needs more than max_states states
+ */
+SpanMatcher::SpanMatcher(const Graph &nfa, const std::size_t &max_states)
+    : m_forward(compile(nfa, max_states)),
+      m_reverse(compile(*Automata::reverse(nfa), max_states))
+{
+}
+
+// Access Methods
+/**
+ * @brief
+ * Get the DFA finding the ends of the matches
+ * @return const Matcher& forward DFA
+ */
+const Matcher &SpanMatcher::get_forward() const
+{
+    return this->m_forward;
+}
+
+/**
+ * @brief
+ * Get the DFA finding the starts of the matches
+ * @return const Matcher& DFA of the reversed NFA
+ */
+const Matcher &SpanMatcher::get_reverse() const
+{
+    return this->m_reverse;
+}
+
+/**
+ * @brief
+ * Get the memory held by the tables of both DFAs
+ * @return std::size_t size in bytes
+ */
+std::size_t SpanMatcher::get_memory_usage() const
+{
+    return sizeof(SpanMatcher) + this->m_forward.get_memory_usage() +
+           this->m_reverse.get_memory_usage();
+}
+
+// Methods
+/**
+ * @brief
+ * Finds every leftmost-longest match of the input, in one reverse pass
+ * over the input and one anchored forward run per match
+ * @param input Input to be searched
+ * @param skip_empty Whether to leave empty matches out, as grep -o does;
+ * the search still advances past them the same way
+ * @return std::vector<MatchSpan> matches in order of start offset
+ */
+std::vector<MatchSpan> SpanMatcher::find_all(std::string_view input,
+                                             const bool &skip_empty) const
+{
+    const unsigned char *data =
+        reinterpret_cast<const unsigned char *>(input.data());
+    const std::size_t size = input.size();
+
+    // starts[i] is set when a match starts at offset i
+    std::vector<bool> starts(size + 1);
+    std::uint32_t state = this->m_reverse.get_search_start();
+    bool any = starts[size] = this->m_reverse.is_search_accepting(state);
+
+    for (std::size_t i = size; i-- > 0;)
+    {
+        state = this->m_reverse.search_step(state, data[i]);
+
+        if (this->m_reverse.is_search_accepting(state))
+            any = starts[i] = true;
+    }
+
+    std::vector<MatchSpan> matches;
+
+    if (!any)
+        return matches;
+
+    for (std::size_t from = 0; from <= size;)
+    {
+        std::size_t start = from;
+
+        while (start <= size && !starts[start])
+            start++;
+
+        if (start > size)
+            break;
+
+        state = this->m_forward.get_start();
+        std::size_t end = start;
+
+        for (std::size_t i = start; i < size && state != 0; i++)
+        {
+            state = this->m_forward.step(state, data[i]);
+
+            if (this->m_forward.is_accepting(state))
+                end = i + 1;
+        }
+
+        if (end > start || !skip_empty)
+            matches.push_back({start, end});
+
+        from = end > start ? end : end + 1;
+    }
+
+    return matches;
+}
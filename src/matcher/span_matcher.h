@@ -0,0 +1,80 @@
+/**
+ * @file span_matcher.h
+ * @author Carlos Salguero
+ * @brief Declaration of the SpanMatcher class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef SPAN_MATCHER_H
+#define SPAN_MATCHER_H
+
+// C++ Standard Library
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+// Project files
+#include "matcher.h"
+#include "../graph/graph.h"
+
+// Structs
+/**
+ * @struct MatchSpan
+ * @brief Match found in an input, as offsets [start, end)
+ */
+struct MatchSpan
+{
+    std::size_t start;
+    std::size_t end;
+
+    bool operator==(const MatchSpan &) const = default;
+};
+
+// Class
+/**
+ * @class SpanMatcher
+ * @brief Reports the offsets of every leftmost-longest match of an input.
+ *
+ * The minimal DFA of the reversed NFA is run once over the whole input,
+ * from its last byte to its first, and marks every offset where a match
+ * starts. The forward DFA then runs anchored from the leftmost marked
+ * offset until it dies, and the last accepting offset it passed is the
+ * end of the longest match. Offsets where no match starts are never
+ * visited again, so the search does not restart at every position; only
+ * forward runs that stay alive past the end of their match, as in
+ * `a|a*b` over a run of `a`, read bytes more than once.
+ *
+ * Matches do not overlap: the next one is searched from the end of the
+ * previous one, or one byte further after an empty match. A SpanMatcher
+ * never changes after construction and may be shared across threads.
+ */
+class SpanMatcher
+{
+public:
+    // Constructors
+    SpanMatcher(const Graph &,
+                const std::size_t &max_states = MATCHER_SEARCH_STATE_BUDGET);
+
+    // Destructor
+    ~SpanMatcher() = default;
+
+    // Access Methods
+    const Matcher &get_forward() const;
+    const Matcher &get_reverse() const;
+    std::size_t get_memory_usage() const;
+
+    // Methods
+    std::vector<MatchSpan> find_all(std::string_view,
+                                    const bool &skip_empty = false) const;
+
+private:
+    Matcher m_forward;
+    Matcher m_reverse;
+};
+
+#endif //! SPAN_MATCHER_H
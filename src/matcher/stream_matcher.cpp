@@ -0,0 +1,147 @@
+/**
+ * @file stream_matcher.cpp
+ * @author Carlos Salguero
+ * @brief Implementation of the StreamMatcher class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+// Project files
+#include "stream_matcher.h"
+
+// Constructors
+/**
+ * @brief
+ * Construct a new StreamMatcher:: StreamMatcher object at offset 0
+ * @param matcher Compiled DFA, shared with other matchers
+ */
+StreamMatcher::StreamMatcher(const std::shared_ptr<const Matcher> &matcher)
+    : m_matcher(matcher)
+{
+    this->m_stride = this->m_matcher->get_class_count();
+    this->m_threads.reserve(this->m_matcher->get_state_count());
+    this->m_next.reserve(this->m_matcher->get_state_count());
+
+    this->reset();
+}
+
+// Access Methods
+/**
+ * @brief
+ * Get the number of bytes fed since the last reset
+ * @return std::uint64_t absolute offset of the next byte
+ */
+std::uint64_t StreamMatcher::get_offset() const
+{
+    return this->m_offset;
+}
+
+/**
+ * @brief
+ * Get the number of matches reported since the last reset
+ * @return std::uint64_t number of matches
+ */
+std::uint64_t StreamMatcher::get_match_count() const
+{
+    return this->m_match_count;
+}
+
+/**
+ * @brief
+ * Get the number of live DFA states carried to the next chunk
+ * @return std::size_t number of threads
+ */
+std::size_t StreamMatcher::get_thread_count() const
+{
+    return this->m_threads.size();
+}
+
+// Methods
+/**
+ * @brief
+ * Consumes the next chunk of the stream, reporting the matches ending in it
+ * @param chunk Bytes following the previous chunk
+ * @param callback Called once per match, in order of end offset
+ * @return std::size_t number of matches reported for this chunk
+ */
+std::size_t StreamMatcher::feed(std::span<const char> chunk,
+                                const StreamCallback &callback)
+{
+    const Matcher &matcher = *this->m_matcher;
+    const std::uint32_t start = matcher.get_start();
+    std::size_t found = 0;
+
+    for (const char &character : chunk)
+    {
+        const unsigned char byte = static_cast<unsigned char>(character);
+        const std::uint64_t stamp = this->m_offset + 1;
+
+        // A match may begin at every offset; it starts after the others
+        this->m_threads.push_back({start, this->m_offset});
+        this->m_next.clear();
+
+        bool matched = false;
+        std::uint64_t match_start = 0;
+
+        for (const Thread &thread : this->m_threads)
+        {
+            std::uint32_t next = matcher.step(thread.state, byte);
+            std::uint32_t row = next / this->m_stride;
+
+            if (next == 0 || this->m_seen[row] == stamp)
+                continue;
+
+            this->m_seen[row] = stamp;
+            this->m_next.push_back({next, thread.start});
+
+            if (!matched && matcher.is_accepting(next))
+            {
+                matched = true;
+                match_start = thread.start;
+            }
+        }
+
+        this->m_threads.swap(this->m_next);
+        this->m_offset++;
+
+        if (matched)
+        {
+            this->m_match_count++;
+            found++;
+            callback({match_start, this->m_offset});
+        }
+    }
+
+    return found;
+}
+
+/**
+ * @brief
+ * Consumes the next chunk of the stream
+ * @param chunk Bytes following the previous chunk
+ * @return std::vector<StreamMatch> matches ending in this chunk
+ */
+std::vector<StreamMatch> StreamMatcher::feed(std::span<const char> chunk)
+{
+    std::vector<StreamMatch> matches;
+
+    this->feed(chunk, [&](const StreamMatch &match)
+               { matches.push_back(match); });
+
+    return matches;
+}
+
+/**
+ * @brief
+ * Forgets every live state and moves back to offset 0
+ */
+void StreamMatcher::reset()
+{
+    this->m_offset = 0;
+    this->m_match_count = 0;
+    this->m_threads.clear();
+    this->m_seen.assign(this->m_matcher->get_state_count(), 0);
+}
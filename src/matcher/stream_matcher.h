@@ -0,0 +1,93 @@
+/**
+ * @file stream_matcher.h
+ * @author Carlos Salguero
+ * @brief Declaration of the StreamMatcher class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef STREAM_MATCHER_H
+#define STREAM_MATCHER_H
+
+// C++ Standard Library
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <span>
+#include <vector>
+
+// Project files
+#include "matcher.h"
+
+// Structs
+/**
+ * @struct StreamMatch
+ * @brief Match found in a stream, as absolute offsets [start, end)
+ */
+struct StreamMatch
+{
+    std::uint64_t start;
+    std::uint64_t end;
+
+    bool operator==(const StreamMatch &) const = default;
+};
+
+using StreamCallback = std::function<void(const StreamMatch &)>;
+
+// Class
+/**
+ * @class StreamMatcher
+ * @brief Unanchored matcher fed one chunk at a time.
+ *
+ * Every offset where a non-empty match ends is reported once, together with
+ * the leftmost start of a match ending there. The matcher keeps one thread
+ * per live state of the anchored DFA, each holding the leftmost start that
+ * reached it, so memory is bounded by the DFA and not by the input.
+ */
+class StreamMatcher
+{
+public:
+    // Constructors
+    StreamMatcher(const std::shared_ptr<const Matcher> &);
+
+    // Destructor
+    ~StreamMatcher() = default;
+
+    // Access Methods
+    std::uint64_t get_offset() const;
+    std::uint64_t get_match_count() const;
+    std::size_t get_thread_count() const;
+
+    // Methods
+    std::size_t feed(std::span<const char>, const StreamCallback &);
+    std::vector<StreamMatch> feed(std::span<const char>);
+    void reset();
+
+private:
+    /**
+     * @struct Thread
+     * @brief Live state of the anchored DFA and the leftmost start of the
+     * matches that reached it
+     */
+    struct Thread
+    {
+        std::uint32_t state;
+        std::uint64_t start;
+    };
+
+    std::shared_ptr<const Matcher> m_matcher;
+    std::uint32_t m_stride;
+
+    std::uint64_t m_offset;
+    std::uint64_t m_match_count;
+
+    // Threads ordered by start, at most one per DFA state
+    std::vector<Thread> m_threads;
+    std::vector<Thread> m_next;
+    std::vector<std::uint64_t> m_seen;
+};
+
+#endif //! STREAM_MATCHER_H
@@ -0,0 +1,512 @@
+/**
+ * @file ast.h
+ * @author Carlos Salguero
+ * @brief Declaration of the Ast class, the syntax tree of a regular
+ * expression
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef AST_H
+#define AST_H
+
+// C++ Standard Library
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+// Project files
+#include "../graph/graph.h"
+#include "byte_set.h"
+
+// Constants
+constexpr std::string_view SPECIAL_CHARACTERS = "()[]{}*+?|.\\";
+constexpr std::string_view CLASS_SPECIAL_CHARACTERS = "[]^-\\";
+constexpr unsigned char NEWLINE = '\n';
+constexpr int REPEAT_UNBOUNDED = -1;
+constexpr int MAX_REPETITION = 1000;
+constexpr std::size_t MAX_EXPANDED_SIZE = 100000;
+constexpr int MAX_NESTING_DEPTH = 2000;
+
+// Enums
+/**
+ * @enum NodeType
+ * @brief Kind of a node of the syntax tree
+ */
+enum class NodeType
+{
+    EMPTY,
+    LITERAL,
+    CLASS,
+    CONCAT,
+    ALTERNATE,
+    STAR,
+    PLUS,
+    REPEAT
+};
+
+// Structs
+/**
+ * @struct Node
+ * @brief Node of the syntax tree. A literal matches its symbol and a class
+ * any byte of its set. Concatenations and alternations have any number of
+ * children, stars, pluses and repetitions exactly one. A repetition matches
+ * its child between min and max times, max being REPEAT_UNBOUNDED for no
+ * upper bound. The hash depends only on how the
+ * subtree is spelled, so equal subtrees have equal hashes. The expanded
+ * size counts the nodes of the subtree once every counted repetition is
+ * spelled out copy by copy, which is what the NFA grows with. The depth
+ * is the number of nodes on the longest path down to a leaf, which bounds
+ * the recursion of everything that walks the tree.
+ */
+struct Node
+{
+    NodeType type = NodeType::EMPTY;
+    char symbol = EPSILON;
+    std::vector<int> children;
+    ByteSet set;
+    int min = 0;
+    int max = 0;
+    std::size_t hash = 0;
+    std::size_t expanded = 1;
+    int depth = 1;
+};
+
+// Class
+/**
+ * @class Ast
+ * @brief Syntax tree of a regular expression, with its nodes stored in one
+ * array and linked by index. A node may be the child of several others,
+ * which only means the subexpression is spelled out at every use.
+ *
+ * Everything is constexpr so that StaticRegex parses at compile time with
+ * the same code as Automata does at run time.
+ */
+class Ast
+{
+public:
+    // Constructors
+    constexpr Ast() = default;
+
+    // Destructor
+    constexpr ~Ast() = default;
+
+    // Access Methods
+    /**
+     * @brief
+     * Get a node
+     * @param index Index of the node
+     * @return const Node& node
+     */
+    constexpr const Node &get_node(const int &index) const
+    {
+        return this->m_nodes[index];
+    }
+
+    /**
+     * @brief
+     * Get the number of nodes
+     * @return std::size_t number of nodes, shared ones counted once
+     */
+    constexpr std::size_t size() const
+    {
+        return this->m_nodes.size();
+    }
+
+    /**
+     * @brief
+     * Get the root of the tree
+     * @return int index of the root node
+     */
+    constexpr int get_root() const
+    {
+        return this->m_root;
+    }
+
+    /**
+     * @brief
+     * Set the root of the tree
+     * @param root Index of the root node
+     */
+    constexpr void set_root(const int &root)
+    {
+        this->m_root = root;
+    }
+
+    // Methods
+    /**
+     * @brief
+     * Reserves room for nodes, so that adding them does not move the ones
+     * already added
+     * @param capacity Number of nodes
+     */
+    constexpr void reserve(const std::size_t &capacity)
+    {
+        this->m_nodes.reserve(capacity);
+    }
+
+    /**
+     * @brief
+     * Adds a node
+     * @param type Kind of the node
+     * @param symbol Symbol of a literal
+     * @param children Indexes of the children
+     * @return int index of the new node
+     */
+    constexpr int add(const NodeType &type, const char &symbol = EPSILON,
+                      std::vector<int> children = {})
+    {
+        std::size_t hash = static_cast<std::size_t>(type) * 257 +
+                           static_cast<unsigned char>(symbol);
+
+        std::size_t expanded = 1;
+        int depth = 1;
+
+        for (const int &child : children)
+        {
+            hash = hash * 1000003 ^ this->m_nodes[child].hash;
+            expanded += this->m_nodes[child].expanded;
+
+            if (this->m_nodes[child].depth >= depth)
+                depth = this->m_nodes[child].depth + 1;
+        }
+
+        this->m_nodes.push_back({type, symbol, std::move(children), {}, 0, 0,
+                                 hash, expanded, depth});
+        return static_cast<int>(this->m_nodes.size()) - 1;
+    }
+
+    /**
+     * @brief
+     * Adds a class node, or a literal if the set has a single byte
+     * @param set Bytes matched by the class
+     * @return int index of the new node
+     */
+    constexpr int add(const ByteSet &set)
+    {
+        std::vector<ByteRange> ranges = set.ranges();
+
+        if (ranges.size() == 1 && ranges[0].low == ranges[0].high)
+            return this->add(NodeType::LITERAL,
+                             static_cast<char>(ranges[0].low));
+
+        std::size_t hash = static_cast<std::size_t>(NodeType::CLASS) * 257;
+
+        for (const std::uint64_t &word : set.words)
+            hash = hash * 1000003 ^ static_cast<std::size_t>(word);
+
+        this->m_nodes.push_back(
+            {NodeType::CLASS, EPSILON, {}, set, 0, 0, hash, 1, 1});
+        return static_cast<int>(this->m_nodes.size()) - 1;
+    }
+
+    /**
+     * @brief
+     * Adds a counted repetition node
+     * @param child Index of the repeated subtree
+     * @param min Smallest number of repetitions
+     * @param max Largest number of repetitions, REPEAT_UNBOUNDED for none
+     * @return int index of the new node
+     */
+    constexpr int add(const int &child, const int &min, const int &max)
+    {
+        std::size_t hash = static_cast<std::size_t>(NodeType::REPEAT) * 257;
+
+        hash = hash * 1000003 ^ static_cast<std::size_t>(min);
+        hash = hash * 1000003 ^ static_cast<std::size_t>(max);
+        hash = hash * 1000003 ^ this->m_nodes[child].hash;
+
+        const int copies = max == REPEAT_UNBOUNDED ? (min > 1 ? min : 1) : max;
+        const std::size_t expanded =
+            1 + static_cast<std::size_t>(copies) * this->m_nodes[child].expanded;
+
+        this->m_nodes.push_back({NodeType::REPEAT, EPSILON, {child}, {}, min,
+                                 max, hash, expanded,
+                                 this->m_nodes[child].depth + 1});
+        return static_cast<int>(this->m_nodes.size()) - 1;
+    }
+
+    /**
+     * @brief
+     * Checks if two subtrees are spelled the same
+     * @param left Index of the first subtree
+     * @param right Index of the second subtree
+     * @return true if both have the same shape and symbols
+     */
+    constexpr bool equal(const int &left, const int &right) const
+    {
+        if (left == right)
+            return true;
+
+        const Node &a = this->m_nodes[left];
+        const Node &b = this->m_nodes[right];
+
+        if (a.hash != b.hash || a.type != b.type || a.symbol != b.symbol ||
+            a.set != b.set || a.min != b.min || a.max != b.max ||
+            a.children.size() != b.children.size())
+            return false;
+
+        for (std::size_t i = 0; i < a.children.size(); i++)
+            if (!this->equal(a.children[i], b.children[i]))
+                return false;
+
+        return true;
+    }
+
+    /**
+     * @brief
+     * Checks if a subtree matches the empty string
+     * @param index Index of the subtree
+     * @return true if the subtree is nullable
+     */
+    constexpr bool nullable(const int &index) const
+    {
+        const Node &node = this->m_nodes[index];
+
+        switch (node.type)
+        {
+        case NodeType::EMPTY:
+        case NodeType::STAR:
+            return true;
+
+        case NodeType::LITERAL:
+        case NodeType::CLASS:
+            return false;
+
+        case NodeType::PLUS:
+            return this->nullable(node.children[0]);
+
+        case NodeType::REPEAT:
+            return node.min == 0 || this->nullable(node.children[0]);
+
+        case NodeType::ALTERNATE:
+            for (const int &child : node.children)
+                if (this->nullable(child))
+                    return true;
+
+            return false;
+
+        case NodeType::CONCAT:
+            for (const int &child : node.children)
+                if (!this->nullable(child))
+                    return false;
+
+            return true;
+        }
+
+        return false;
+    }
+
+    /**
+     * @brief
+     * Spells the tree back as an expression, with only the parentheses
+     * precedence needs. The empty string is spelled as nothing at the root
+     * and in an alternative, and as `()` anywhere else.
+     * @return std::string expression
+     */
+    constexpr std::string to_string() const
+    {
+        return this->m_root < 0 ||
+                       this->m_nodes[this->m_root].type == NodeType::EMPTY
+                   ? std::string()
+                   : this->to_string(this->m_root);
+    }
+
+private:
+    std::vector<Node> m_nodes;
+    int m_root = -1;
+
+    // Methods
+    /**
+     * @brief
+     * Spells a byte as the parser reads it, escaping special characters and
+     * writing unprintable bytes in hexadecimal
+     * @param result Expression being spelled
+     * @param byte Byte to be spelled
+     * @param special Characters that must be escaped
+     */
+    static constexpr void spell(std::string &result, const unsigned char &byte,
+                                const std::string_view &special)
+    {
+        constexpr std::string_view digits = "0123456789abcdef";
+
+        if (byte == '\n')
+            result += "\\n";
+
+        else if (byte == '\t')
+            result += "\\t";
+
+        else if (byte < 0x20 || byte >= 0x7f)
+        {
+            result += "\\x";
+            result += digits[byte >> 4];
+            result += digits[byte & 15];
+        }
+
+        else
+        {
+            if (special.find(static_cast<char>(byte)) != std::string_view::npos)
+                result += '\\';
+
+            result += static_cast<char>(byte);
+        }
+    }
+
+    /**
+     * @brief
+     * Spells a count in decimal
+     * @param value Non-negative count
+     * @return std::string digits
+     */
+    static constexpr std::string number(int value)
+    {
+        std::string digits;
+
+        do
+        {
+            digits.insert(digits.begin(), static_cast<char>('0' + value % 10));
+            value /= 10;
+        } while (value > 0);
+
+        return digits;
+    }
+
+    /**
+     * @brief
+     * Spells a subtree as an expression
+     * @param index Index of the subtree
+     * @return std::string expression
+     */
+    constexpr std::string to_string(const int &index) const
+    {
+        const Node &node = this->m_nodes[index];
+        std::string result;
+
+        auto operand = [&](const int &child, const NodeType &below)
+        {
+            NodeType type = this->m_nodes[child].type;
+            bool group = type == NodeType::ALTERNATE ||
+                         (below == NodeType::STAR && type == NodeType::CONCAT);
+
+            if (group)
+                result += '(';
+
+            result += this->to_string(child);
+
+            if (group)
+                result += ')';
+        };
+
+        switch (node.type)
+        {
+        case NodeType::EMPTY:
+            result += "()";
+            break;
+
+        case NodeType::LITERAL:
+            spell(result, static_cast<unsigned char>(node.symbol),
+                  SPECIAL_CHARACTERS);
+            break;
+
+        case NodeType::CLASS:
+        {
+            ByteSet set = node.set;
+            ByteSet any;
+
+            any.insert(0, 255);
+            any.words[NEWLINE >> 6] &= ~(std::uint64_t(1) << (NEWLINE & 63));
+
+            if (set == any)
+            {
+                result += '.';
+                break;
+            }
+
+            if (set.count() == 0)
+            {
+                result += "[^\\x00-\\xff]";
+                break;
+            }
+
+            result += '[';
+
+            if (set.count() > 128 && set.count() < 256)
+            {
+                result += '^';
+                set.negate();
+            }
+
+            for (const ByteRange &range : set.ranges())
+            {
+                spell(result, range.low, CLASS_SPECIAL_CHARACTERS);
+
+                if (range.high > range.low + 1)
+                    result += '-';
+
+                if (range.high > range.low)
+                    spell(result, range.high, CLASS_SPECIAL_CHARACTERS);
+            }
+
+            result += ']';
+            break;
+        }
+
+        case NodeType::CONCAT:
+            for (const int &child : node.children)
+                operand(child, NodeType::CONCAT);
+
+            break;
+
+        case NodeType::ALTERNATE:
+            for (std::size_t i = 0; i < node.children.size(); i++)
+            {
+                if (i > 0)
+                    result += '|';
+
+                if (this->m_nodes[node.children[i]].type != NodeType::EMPTY)
+                    result += this->to_string(node.children[i]);
+            }
+
+            break;
+
+        case NodeType::STAR:
+        case NodeType::PLUS:
+            operand(node.children[0], NodeType::STAR);
+            result += node.type == NodeType::STAR ? '*' : '+';
+
+            break;
+
+        case NodeType::REPEAT:
+            operand(node.children[0], NodeType::STAR);
+
+            if (node.min == 0 && node.max == 1)
+            {
+                result += '?';
+                break;
+            }
+
+            result += '{';
+            result += number(node.min);
+
+            if (node.max != node.min)
+            {
+                result += ',';
+
+                if (node.max != REPEAT_UNBOUNDED)
+                    result += number(node.max);
+            }
+
+            result += '}';
+            break;
+        }
+
+        return result;
+    }
+};
+
+#endif //! AST_H
@@ -0,0 +1,147 @@
+/**
+ * @file byte_set.h
+ * @author Carlos Salguero
+ * @brief Declaration of the ByteSet struct
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef BYTE_SET_H
+#define BYTE_SET_H
+
+// C++ Standard Library
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+// Structs
+/**
+ * @struct ByteRange
+ * @brief Inclusive range of byte values
+ */
+struct ByteRange
+{
+    unsigned char low;
+    unsigned char high;
+
+    constexpr bool operator==(const ByteRange &) const = default;
+};
+
+/**
+ * @struct ByteSet
+ * @brief Set of byte values as a 256-bit mask, usable in constant
+ * evaluation unlike std::bitset
+ */
+struct ByteSet
+{
+    std::array<std::uint64_t, 4> words = {};
+
+    /**
+     * @brief
+     * Adds a range of bytes
+     * @param low Smallest byte of the range
+     * @param high Largest byte of the range
+     */
+    constexpr void insert(const unsigned char &low, const unsigned char &high)
+    {
+        for (int byte = low; byte <= high; byte++)
+            this->words[byte >> 6] |= std::uint64_t(1) << (byte & 63);
+    }
+
+    /**
+     * @brief
+     * Adds a byte
+     * @param byte Byte to be added
+     */
+    constexpr void insert(const unsigned char &byte)
+    {
+        this->insert(byte, byte);
+    }
+
+    /**
+     * @brief
+     * Checks if a byte is in the set
+     * @param byte Byte to be checked
+     * @return true if the byte is in the set
+     */
+    constexpr bool contains(const unsigned char &byte) const
+    {
+        return (this->words[byte >> 6] >> (byte & 63)) & 1;
+    }
+
+    /**
+     * @brief
+     * Replaces the set by its complement
+     */
+    constexpr void negate()
+    {
+        for (std::uint64_t &word : this->words)
+            word = ~word;
+    }
+
+    /**
+     * @brief
+     * Adds every byte of another set
+     * @param other Set to be added
+     * @return ByteSet& this set
+     */
+    constexpr ByteSet &operator|=(const ByteSet &other)
+    {
+        for (std::size_t i = 0; i < this->words.size(); i++)
+            this->words[i] |= other.words[i];
+
+        return *this;
+    }
+
+    constexpr bool operator==(const ByteSet &) const = default;
+
+    /**
+     * @brief
+     * Counts the bytes of the set
+     * @return std::size_t number of bytes
+     */
+    constexpr std::size_t count() const
+    {
+        std::size_t total = 0;
+
+        for (int byte = 0; byte < 256; byte++)
+            total += this->contains(static_cast<unsigned char>(byte));
+
+        return total;
+    }
+
+    /**
+     * @brief
+     * Splits the set into maximal ranges of consecutive bytes
+     * @return std::vector<ByteRange> ranges in increasing order
+     */
+    constexpr std::vector<ByteRange> ranges() const
+    {
+        std::vector<ByteRange> result;
+
+        for (int byte = 0; byte < 256; byte++)
+        {
+            if (!this->contains(static_cast<unsigned char>(byte)))
+                continue;
+
+            int high = byte;
+
+            while (high + 1 < 256 &&
+                   this->contains(static_cast<unsigned char>(high + 1)))
+                high++;
+
+            result.push_back({static_cast<unsigned char>(byte),
+                              static_cast<unsigned char>(high)});
+            byte = high;
+        }
+
+        return result;
+    }
+};
+
+#endif //! BYTE_SET_H
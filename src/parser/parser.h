@@ -0,0 +1,477 @@
+/**
+ * @file parser.h
+ * @author Carlos Salguero
+ * @brief Declaration of the Parser class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef PARSER_H
+#define PARSER_H
+
+// C++ Standard Library
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Project files
+#include "ast.h"
+#include "byte_set.h"
+
+// Class
+/**
+ * @class Parser
+ * @brief Recursive descent parser of regular expressions into an Ast.
+ *
+ * From the loosest to the tightest binding, the grammar is
+ *
+ *     alternation   := concatenation ('|' concatenation)*
+ *     concatenation := repetition*
+ *     repetition    := atom ('*' | '+' | '?' | bound)*
+ *     bound         := '{' count '}' | '{' count ',' count? '}'
+ *     atom          := '(' alternation ')' | '[' class ']' | '.'
+ *                    | '\' escape | character
+ *
+ * so `ab|c` is `(ab)|c`. An empty concatenation, as in `()` or `a|`,
+ * matches the empty string; every other character, `E` included, matches
+ * itself. `.` matches any byte but a newline and a class
+ * any byte of its ranges, or of none of them after `^`. Escapes are `\n`,
+ * `\t`, `\r`, `\xHH`, the classes `\d`, `\w`, `\s` and their complements
+ * `\D`, `\W`, `\S`, and a backslash before any other character makes it
+ * literal. `x?` is `x{0,1}`, `x{m}` matches exactly m copies of x, `x{m,}`
+ * at least m and `x{m,n}` between m and n, every count being at most
+ * MAX_REPETITION. Nested counts multiply, so the expression spelled out
+ * copy by copy must also stay within MAX_EXPANDED_SIZE nodes, and groups
+ * and repetitions may nest at most MAX_NESTING_DEPTH deep, which keeps the
+ * recursion of the parser and of every walk of the tree within the stack.
+ * Malformed expressions throw std::invalid_argument, which in a constant evaluation
+ * is a compile error.
+ */
+class Parser
+{
+public:
+    // Constructors
+    /**
+     * @brief
+     * Construct a new Parser:: Parser object
+     * @param expression Regular expression
+     */
+    constexpr Parser(std::string_view expression)
+        : m_expression(expression)
+    {
+    }
+
+    // Destructor
+    constexpr ~Parser() = default;
+
+    // Methods
+    /**
+     * @brief
+     * Parses the whole expression
+     * @return Ast syntax tree of the expression
+     */
+    constexpr Ast parse()
+    {
+        Ast ast;
+
+        ast.reserve(2 * this->m_expression.size() + 1);
+        this->m_position = 0;
+        this->m_depth = 0;
+        ast.set_root(this->alternation(ast));
+
+        if (this->m_position < this->m_expression.size())
+            this->fail("unmatched ')'");
+
+        if (ast.get_node(ast.get_root()).expanded > MAX_EXPANDED_SIZE)
+            this->fail("expression too large once repetitions are expanded");
+
+        return ast;
+    }
+
+private:
+    std::string_view m_expression;
+    std::size_t m_position = 0;
+    int m_depth = 0;
+
+    // Methods
+    /**
+     * @brief
+     * Parses alternatives separated by '|'
+     * @param ast Tree the nodes are added to
+     * @return int index of the node
+     */
+    constexpr int alternation(Ast &ast)
+    {
+        std::vector<int> branches = {this->concatenation(ast)};
+
+        while (this->peek() == '|')
+        {
+            this->m_position++;
+            branches.push_back(this->concatenation(ast));
+        }
+
+        if (branches.size() == 1)
+            return branches[0];
+
+        return ast.add(NodeType::ALTERNATE, EPSILON, std::move(branches));
+    }
+
+    /**
+     * @brief
+     * Parses repetitions up to the next '|' or ')'
+     * @param ast Tree the nodes are added to
+     * @return int index of the node
+     */
+    constexpr int concatenation(Ast &ast)
+    {
+        std::vector<int> parts;
+
+        while (this->m_position < this->m_expression.size() &&
+               this->peek() != '|' && this->peek() != ')')
+        {
+            parts.push_back(this->repetition(ast));
+
+            if (ast.get_node(parts.back()).depth + 2 > MAX_NESTING_DEPTH)
+                this->fail("expression nested too deeply");
+        }
+
+        if (parts.empty())
+            return ast.add(NodeType::EMPTY);
+
+        if (parts.size() == 1)
+            return parts[0];
+
+        return ast.add(NodeType::CONCAT, EPSILON, std::move(parts));
+    }
+
+    /**
+     * @brief
+     * Parses an atom followed by any number of '*', '+', '?' and bounds
+     * @param ast Tree the nodes are added to
+     * @return int index of the node
+     */
+    constexpr int repetition(Ast &ast)
+    {
+        int node = this->atom(ast);
+
+        while (true)
+        {
+            char character = this->peek();
+
+            if (character == '*' || character == '+')
+            {
+                NodeType type = character == '*' ? NodeType::STAR
+                                                 : NodeType::PLUS;
+
+                this->m_position++;
+                node = ast.add(type, EPSILON, {node});
+            }
+
+            else if (character == '?')
+            {
+                this->m_position++;
+                node = ast.add(node, 0, 1);
+            }
+
+            else if (character == '{')
+            {
+                this->m_position++;
+
+                int min = this->count();
+                int max = min;
+
+                if (this->peek() == ',')
+                {
+                    this->m_position++;
+                    max = this->peek() == '}' ? REPEAT_UNBOUNDED
+                                              : this->count();
+                }
+
+                if (this->peek() != '}')
+                    this->fail("missing '}'");
+
+                if (max != REPEAT_UNBOUNDED && max < min)
+                    this->fail("repetition bounds out of order");
+
+                this->m_position++;
+                node = ast.add(node, min, max);
+
+                if (ast.get_node(node).expanded > MAX_EXPANDED_SIZE)
+                    this->fail("repetition too large once expanded");
+            }
+
+            else
+                return node;
+        }
+    }
+
+    /**
+     * @brief
+     * Parses the count of a bound
+     * @return int count, at most MAX_REPETITION
+     */
+    constexpr int count()
+    {
+        if (this->peek() < '0' || this->peek() > '9')
+            this->fail("expected a repetition count");
+
+        int value = 0;
+
+        while (this->peek() >= '0' && this->peek() <= '9')
+        {
+            value = 10 * value + (this->peek() - '0');
+            this->m_position++;
+
+            if (value > MAX_REPETITION)
+                this->fail("repetition count too large");
+        }
+
+        return value;
+    }
+
+    /**
+     * @brief
+     * Parses a group, a class, an escape or a character
+     * @param ast Tree the nodes are added to
+     * @return int index of the node
+     */
+    constexpr int atom(Ast &ast)
+    {
+        char character = this->m_expression[this->m_position++];
+
+        switch (character)
+        {
+        case '(':
+        {
+            if (++this->m_depth > MAX_NESTING_DEPTH)
+                this->fail("groups nested too deeply");
+
+            int node = this->alternation(ast);
+
+            if (this->peek() != ')')
+                this->fail("missing ')'");
+
+            this->m_depth--;
+            this->m_position++;
+            return node;
+        }
+
+        case '*':
+        case '+':
+        case '?':
+        case '{':
+            this->m_position--;
+            this->fail("nothing to repeat");
+
+        case '[':
+            return ast.add(this->bracket());
+
+        case '.':
+        {
+            ByteSet set;
+
+            set.insert(0, 255);
+            set.words[NEWLINE >> 6] &= ~(std::uint64_t(1) << (NEWLINE & 63));
+
+            return ast.add(set);
+        }
+
+        case '\\':
+            return ast.add(this->escape());
+
+        default:
+            return ast.add(NodeType::LITERAL, character);
+        }
+    }
+
+    /**
+     * @brief
+     * Parses the rest of a bracketed class, after its '['
+     * @return ByteSet bytes matched by the class
+     */
+    constexpr ByteSet bracket()
+    {
+        ByteSet set;
+        bool negated = false;
+
+        if (this->peek() == '^')
+        {
+            negated = true;
+            this->m_position++;
+        }
+
+        bool first = true;
+
+        while (first || this->peek() != ']')
+        {
+            if (this->m_position == this->m_expression.size())
+                this->fail("missing ']'");
+
+            first = false;
+
+            ByteSet low = this->member();
+            std::vector<ByteRange> ranges = low.ranges();
+
+            bool range = this->peek() == '-' &&
+                         this->m_position + 1 < this->m_expression.size() &&
+                         this->m_expression[this->m_position + 1] != ']';
+
+            if (!range)
+            {
+                set |= low;
+                continue;
+            }
+
+            this->m_position++;
+
+            ByteSet high = this->member();
+            std::vector<ByteRange> last = high.ranges();
+
+            if (ranges.size() != 1 || ranges[0].low != ranges[0].high ||
+                last.size() != 1 || last[0].low != last[0].high)
+                this->fail("a class cannot bound a range");
+
+            if (last[0].low < ranges[0].low)
+                this->fail("range out of order");
+
+            set.insert(ranges[0].low, last[0].low);
+        }
+
+        this->m_position++;
+
+        if (negated)
+            set.negate();
+
+        return set;
+    }
+
+    /**
+     * @brief
+     * Parses a member of a bracketed class
+     * @return ByteSet byte of the member, or the bytes of an escaped class
+     */
+    constexpr ByteSet member()
+    {
+        char character = this->m_expression[this->m_position++];
+
+        if (character == '\\')
+            return this->escape();
+
+        ByteSet set;
+        set.insert(static_cast<unsigned char>(character));
+
+        return set;
+    }
+
+    /**
+     * @brief
+     * Parses the rest of an escape, after its backslash
+     * @return ByteSet bytes matched by the escape
+     */
+    constexpr ByteSet escape()
+    {
+        if (this->m_position == this->m_expression.size())
+            this->fail("trailing '\\'");
+
+        char character = this->m_expression[this->m_position++];
+        ByteSet set;
+
+        switch (character)
+        {
+        case 'n':
+            set.insert('\n');
+            break;
+
+        case 't':
+            set.insert('\t');
+            break;
+
+        case 'r':
+            set.insert('\r');
+            break;
+
+        case 'x':
+        {
+            int value = 0;
+
+            for (int digit = 0; digit < 2; digit++)
+            {
+                char hex = this->peek();
+                int nibble = hex >= '0' && hex <= '9'   ? hex - '0'
+                             : hex >= 'a' && hex <= 'f' ? hex - 'a' + 10
+                             : hex >= 'A' && hex <= 'F' ? hex - 'A' + 10
+                                                        : -1;
+
+                if (nibble < 0 || this->m_position == this->m_expression.size())
+                    this->fail("expected two hexadecimal digits");
+
+                value = value * 16 + nibble;
+                this->m_position++;
+            }
+
+            set.insert(static_cast<unsigned char>(value));
+            break;
+        }
+
+        case 'd':
+        case 'D':
+            set.insert('0', '9');
+            break;
+
+        case 'w':
+        case 'W':
+            set.insert('0', '9');
+            set.insert('A', 'Z');
+            set.insert('a', 'z');
+            set.insert('_');
+            break;
+
+        case 's':
+        case 'S':
+            set.insert('\t', '\r');
+            set.insert(' ');
+            break;
+
+        default:
+            set.insert(static_cast<unsigned char>(character));
+            break;
+        }
+
+        if (character == 'D' || character == 'W' || character == 'S')
+            set.negate();
+
+        return set;
+    }
+
+    /**
+     * @brief
+     * Get the character at the current position
+     * @return char character, '\0' past the end
+     */
+    constexpr char peek() const
+    {
+        return this->m_position < this->m_expression.size()
+                   ? this->m_expression[this->m_position]
+                   : '\0';
+    }
+
+    /**
+     * @brief
+     * Reports a malformed expression
+     * @param message What is wrong at the current position
+     */
+    [[noreturn]] void fail(const char *message) const
+    {
+        throw std::invalid_argument(
+            std::string(message) + " at offset " +
+            std::to_string(this->m_position) + " of \"" +
+            std::string(this->m_expression) + "\"");
+    }
+};
+
+#endif //! PARSER_H
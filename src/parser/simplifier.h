@@ -0,0 +1,482 @@
+/**
+ * @file simplifier.h
+ * @author Carlos Salguero
+ * @brief Declaration of the Simplifier class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef SIMPLIFIER_H
+#define SIMPLIFIER_H
+
+// C++ Standard Library
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+// Project files
+#include "ast.h"
+#include "byte_set.h"
+
+// Class
+/**
+ * @class Simplifier
+ * @brief Rewrites a syntax tree into a smaller one matching the same
+ * strings, bottom up:
+ *
+ * - nested concatenations and alternations are flattened and empty
+ *   factors dropped;
+ * - repeated alternatives are dropped, and so is an empty alternative
+ *   next to another nullable one;
+ * - alternatives matching one byte each merge into one class, `a|[bc]`
+ *   becoming `[a-c]`;
+ * - alternatives sharing a first factor are factored, `abc|abd` becoming
+ *   `ab(c|d)`;
+ * - nested repetitions collapse, `(x*)*`, `(x+)*` and `(x*)+` becoming
+ *   `x*`, and repetitions are stripped from the alternatives of a star;
+ * - counted repetitions that are stars, pluses or single copies in
+ *   disguise become them, `x{0,}` being `x*` and `x{1}` being `x`.
+ *
+ * Alternatives may be reordered, which no engine here can observe.
+ */
+class Simplifier
+{
+public:
+    // Constructors
+    /**
+     * @brief
+     * Construct a new Simplifier:: Simplifier object
+     * @param source Tree to be simplified
+     */
+    constexpr Simplifier(const Ast &source)
+        : m_source(source)
+    {
+    }
+
+    // Destructor
+    constexpr ~Simplifier() = default;
+
+    // Methods
+    /**
+     * @brief
+     * Simplifies the whole tree
+     * @return Ast simplified tree
+     */
+    constexpr Ast simplify()
+    {
+        this->m_result = Ast();
+        this->m_result.reserve(2 * this->m_source.size());
+
+        if (this->m_source.get_root() >= 0)
+            this->m_result.set_root(this->rewrite(this->m_source.get_root()));
+
+        return std::move(this->m_result);
+    }
+
+private:
+    const Ast &m_source;
+    Ast m_result;
+
+    // Methods
+    /**
+     * @brief
+     * Copies a subtree of the source into the result, simplified
+     * @param index Index of the subtree in the source
+     * @return int index of the simplified subtree in the result
+     */
+    constexpr int rewrite(const int &index)
+    {
+        const Node &node = this->m_source.get_node(index);
+        std::vector<int> children;
+
+        for (const int &child : node.children)
+            children.push_back(this->rewrite(child));
+
+        switch (node.type)
+        {
+        case NodeType::CONCAT:
+            return this->concat(std::move(children));
+
+        case NodeType::ALTERNATE:
+            return this->alternate(std::move(children));
+
+        case NodeType::STAR:
+            return this->star(children[0]);
+
+        case NodeType::PLUS:
+            return this->plus(children[0]);
+
+        case NodeType::REPEAT:
+            return this->repeat(children[0], node.min, node.max);
+
+        case NodeType::CLASS:
+            return this->m_result.add(node.set);
+
+        default:
+            return this->m_result.add(node.type, node.symbol);
+        }
+    }
+
+    /**
+     * @brief
+     * Builds the concatenation of simplified subtrees
+     * @param parts Indexes of the factors in the result
+     * @return int index of the concatenation
+     */
+    constexpr int concat(const std::vector<int> &parts)
+    {
+        std::vector<int> flat;
+
+        for (const int &part : parts)
+            for (const int &factor : this->sequence(part))
+                flat.push_back(factor);
+
+        if (flat.empty())
+            return this->m_result.add(NodeType::EMPTY);
+
+        if (flat.size() == 1)
+            return flat[0];
+
+        return this->m_result.add(NodeType::CONCAT, EPSILON, std::move(flat));
+    }
+
+    /**
+     * @brief
+     * Builds the alternation of simplified subtrees
+     * @param branches Indexes of the alternatives in the result
+     * @return int index of the alternation
+     */
+    constexpr int alternate(const std::vector<int> &branches)
+    {
+        std::vector<int> flat;
+
+        for (const int &branch : branches)
+        {
+            if (this->m_result.get_node(branch).type == NodeType::ALTERNATE)
+                for (const int &alternative :
+                     this->m_result.get_node(branch).children)
+                    flat.push_back(alternative);
+
+            else
+                flat.push_back(branch);
+        }
+
+        if (flat.size() == 1)
+            return flat[0];
+
+        std::vector<int> unique;
+        bool empty = false;
+        bool nullable = false;
+
+        for (const std::vector<std::size_t> &copies : this->partition(flat))
+        {
+            int alternative = flat[copies[0]];
+
+            if (this->m_result.get_node(alternative).type == NodeType::EMPTY)
+                empty = true;
+
+            else
+                nullable = nullable || this->m_result.nullable(alternative);
+
+            unique.push_back(alternative);
+        }
+
+        if (empty && nullable)
+            std::erase_if(unique, [&](const int &alternative)
+                          { return this->m_result.get_node(alternative).type ==
+                                   NodeType::EMPTY; });
+
+        // Alternatives of one byte each merge into one class
+        ByteSet bytes;
+        std::size_t merged = 0;
+        std::size_t first_byte = unique.size();
+
+        for (std::size_t i = 0; i < unique.size(); i++)
+        {
+            const Node &node = this->m_result.get_node(unique[i]);
+
+            if (node.type == NodeType::LITERAL)
+                bytes.insert(static_cast<unsigned char>(node.symbol));
+
+            else if (node.type == NodeType::CLASS)
+                bytes |= node.set;
+
+            else
+                continue;
+
+            merged++;
+            first_byte = std::min(first_byte, i);
+        }
+
+        if (merged > 1)
+        {
+            std::erase_if(unique, [&](const int &alternative)
+                          {
+                NodeType type = this->m_result.get_node(alternative).type;
+                return type == NodeType::LITERAL || type == NodeType::CLASS; });
+
+            unique.insert(unique.begin() + first_byte,
+                          this->m_result.add(bytes));
+        }
+
+        std::vector<std::vector<int>> sequences;
+        std::vector<int> heads;
+
+        for (const int &alternative : unique)
+        {
+            sequences.push_back(this->sequence(alternative));
+            heads.push_back(sequences.back().empty() ? -1
+                                                     : sequences.back()[0]);
+        }
+
+        std::vector<int> result;
+
+        for (const std::vector<std::size_t> &group : this->partition(heads))
+        {
+            const std::vector<int> &first = sequences[group[0]];
+
+            if (group.size() == 1)
+            {
+                result.push_back(unique[group[0]]);
+                continue;
+            }
+
+            std::size_t common = 1;
+
+            while (common < first.size())
+            {
+                bool shared = true;
+
+                for (const std::size_t &member : group)
+                    shared = shared && common < sequences[member].size() &&
+                             this->m_result.equal(sequences[member][common],
+                                                  first[common]);
+
+                if (!shared)
+                    break;
+
+                common++;
+            }
+
+            std::vector<int> rests;
+
+            for (const std::size_t &member : group)
+                rests.push_back(this->concat(std::vector<int>(
+                    sequences[member].begin() + common,
+                    sequences[member].end())));
+
+            std::vector<int> factored(first.begin(), first.begin() + common);
+            factored.push_back(this->alternate(rests));
+
+            result.push_back(this->concat(factored));
+        }
+
+        if (result.size() == 1)
+            return result[0];
+
+        return this->m_result.add(NodeType::ALTERNATE, EPSILON,
+                                  std::move(result));
+    }
+
+    /**
+     * @brief
+     * Builds the star of a simplified subtree
+     * @param child Index of the repeated subtree in the result
+     * @return int index of the star
+     */
+    constexpr int star(const int &child)
+    {
+        const Node &node = this->m_result.get_node(child);
+
+        switch (node.type)
+        {
+        case NodeType::EMPTY:
+        case NodeType::STAR:
+            return child;
+
+        case NodeType::PLUS:
+        {
+            int repeated = node.children[0];
+            return this->star(repeated);
+        }
+
+        case NodeType::REPEAT:
+        {
+            // (x{0,n})* and (x{1,n})* are both x*
+            int repeated = node.children[0];
+
+            if (node.min <= 1)
+                return this->star(repeated);
+
+            break;
+        }
+
+        case NodeType::ALTERNATE:
+        {
+            // (x*|y)* and (E|x|y)* are both (x|y)*
+            std::vector<int> stripped;
+            bool changed = false;
+
+            for (const int &branch : node.children)
+            {
+                const Node &alternative = this->m_result.get_node(branch);
+
+                if (alternative.type == NodeType::EMPTY)
+                    changed = true;
+
+                else if (alternative.type == NodeType::STAR ||
+                         alternative.type == NodeType::PLUS)
+                {
+                    stripped.push_back(alternative.children[0]);
+                    changed = true;
+                }
+
+                else
+                    stripped.push_back(branch);
+            }
+
+            if (changed)
+                return this->star(this->alternate(stripped));
+
+            break;
+        }
+
+        default:
+            break;
+        }
+
+        return this->m_result.add(NodeType::STAR, EPSILON, {child});
+    }
+
+    /**
+     * @brief
+     * Builds the plus of a simplified subtree
+     * @param child Index of the repeated subtree in the result
+     * @return int index of the plus
+     */
+    constexpr int plus(const int &child)
+    {
+        const Node &node = this->m_result.get_node(child);
+
+        if (node.type == NodeType::EMPTY || node.type == NodeType::STAR ||
+            node.type == NodeType::PLUS)
+            return child;
+
+        // A nullable plus repeats zero times as well
+        if (this->m_result.nullable(child))
+            return this->star(child);
+
+        return this->m_result.add(NodeType::PLUS, EPSILON, {child});
+    }
+
+    /**
+     * @brief
+     * Builds a counted repetition of a simplified subtree
+     * @param child Index of the repeated subtree in the result
+     * @param min Smallest number of repetitions
+     * @param max Largest number of repetitions, REPEAT_UNBOUNDED for none
+     * @return int index of the repetition
+     */
+    constexpr int repeat(const int &child, const int &min, const int &max)
+    {
+        NodeType type = this->m_result.get_node(child).type;
+
+        if (max == 0 || type == NodeType::EMPTY)
+            return this->m_result.add(NodeType::EMPTY);
+
+        if (type == NodeType::STAR)
+            return child;
+
+        if (max == REPEAT_UNBOUNDED && min <= 1)
+            return min == 0 ? this->star(child) : this->plus(child);
+
+        if (max == 1 && (min == 1 || this->m_result.nullable(child)))
+            return child;
+
+        return this->m_result.add(child, min, max);
+    }
+
+    /**
+     * @brief
+     * Groups the positions of equal subtrees, sorting them by hash so that
+     * only subtrees with equal hashes are compared
+     * @param keys Indexes of subtrees of the result, -1 for one equal to
+     * no other
+     * @return std::vector<std::vector<std::size_t>> positions of every
+     * group, in order of first position
+     */
+    constexpr std::vector<std::vector<std::size_t>> partition(
+        const std::vector<int> &keys) const
+    {
+        std::vector<std::pair<std::size_t, std::size_t>> order;
+
+        for (std::size_t i = 0; i < keys.size(); i++)
+            order.push_back(
+                {keys[i] < 0 ? 0 : this->m_result.get_node(keys[i]).hash, i});
+
+        std::sort(order.begin(), order.end());
+
+        std::vector<std::vector<std::size_t>> groups;
+        std::vector<std::size_t> hashes;
+
+        for (const auto &[hash, position] : order)
+        {
+            bool placed = false;
+
+            // Only the last groups can share the hash of this position
+            for (std::size_t g = groups.size(); g-- > 0 && !placed;)
+            {
+                std::size_t leader = groups[g][0];
+
+                if (hashes[g] != hash)
+                    break;
+
+                if (keys[position] >= 0 && keys[leader] >= 0 &&
+                    this->m_result.equal(keys[position], keys[leader]))
+                {
+                    groups[g].push_back(position);
+                    placed = true;
+                }
+            }
+
+            if (!placed)
+            {
+                groups.push_back({position});
+                hashes.push_back(hash);
+            }
+        }
+
+        std::sort(groups.begin(), groups.end(),
+                  [](const std::vector<std::size_t> &left,
+                     const std::vector<std::size_t> &right)
+                  { return left[0] < right[0]; });
+
+        return groups;
+    }
+
+    /**
+     * @brief
+     * Get the factors of a subtree of the result
+     * @param index Index of the subtree
+     * @return std::vector<int> children of a concatenation, nothing for the
+     * empty string and the subtree itself otherwise
+     */
+    constexpr std::vector<int> sequence(const int &index) const
+    {
+        const Node &node = this->m_result.get_node(index);
+
+        if (node.type == NodeType::CONCAT)
+            return node.children;
+
+        if (node.type == NodeType::EMPTY)
+            return {};
+
+        return {index};
+    }
+};
+
+#endif //! SIMPLIFIER_H
@@ -0,0 +1,300 @@
+/**
+ * @file pattern_set.cpp
+ * @author Carlos Salguero
+ * @brief Implementation of the PatternSet class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+// C++ Standard Library
+#include <algorithm>
+#include <stdexcept>
+
+// Project files
+#include "pattern_set.h"
+#include "../automata/automata.h"
+#include "../automata/byte_classes.h"
+#include "../automata/minimizer.h"
+
+// Access Methods
+/**
+ * @brief
+ * Get the number of patterns added, removed ones included
+ * @return std::size_t number of patterns
+ */
+std::size_t PatternSet::size() const
+{
+    return this->m_patterns.size();
+}
+
+/**
+ * @brief
+ * Get the expression of a pattern
+ * @param id Id of the pattern, as returned by add
+ * @return const std::string& expression
+ */
+const std::string &PatternSet::get_pattern(const int &id) const
+{
+    return this->m_patterns.at(id);
+}
+
+/**
+ * @brief
+ * Get the union NFA of the patterns of the last full rebuild, empty until
+ * compile is called
+ * @return const std::shared_ptr<Graph>& NFA
+ */
+const std::shared_ptr<Graph> &PatternSet::get_nfa() const
+{
+    return this->m_nfa;
+}
+
+/**
+ * @brief
+ * Get the minimal DFA of the patterns of the last full rebuild, empty until
+ * compile is called
+ * @return const std::shared_ptr<Graph>& DFA
+ */
+const std::shared_ptr<Graph> &PatternSet::get_dfa() const
+{
+    return this->m_dfa;
+}
+
+/**
+ * @brief
+ * Get the number of live patterns compiled into the delta level
+ * @return std::size_t number of patterns added since the last full rebuild
+ */
+std::size_t PatternSet::get_delta_count() const
+{
+    return this->m_delta_count;
+}
+
+/**
+ * @brief
+ * Checks if the set was compiled after the last pattern was added
+ * @return true if the set is ready to match
+ */
+bool PatternSet::is_compiled() const
+{
+    return this->m_compiled;
+}
+
+/**
+ * @brief
+ * Checks if a pattern was removed
+ * @param id Id of the pattern, as returned by add
+ * @return true if the pattern was removed
+ */
+bool PatternSet::is_removed(const int &id) const
+{
+    return this->m_removed.at(id);
+}
+
+// Methods (public)
+/**
+ * @brief
+ * Adds a pattern to the set, compiling its NFA. The set must be compiled
+ * again before matching
+ * @param expression Regular expression
+ * @return int id of the pattern
+ * @throws std::invalid_argument if the expression is malformed
+ */
+int PatternSet::add(const std::string &expression)
+{
+    Automata automata(expression);
+
+    this->m_fragments.push_back(automata.build());
+    this->m_patterns.push_back(expression);
+    this->m_removed.push_back(false);
+    this->m_compiled = false;
+
+    return static_cast<int>(this->m_patterns.size()) - 1;
+}
+
+/**
+ * @brief
+ * Removes a pattern. Its id is never given out again and is dropped from
+ * the results at once, without compiling the set again
+ * @param id Id of the pattern, as returned by add
+ * @throws std::out_of_range if there is no such pattern or it was removed
+ */
+void PatternSet::remove(const int &id)
+{
+    if (id < 0 || id >= static_cast<int>(this->m_patterns.size()) ||
+        this->m_removed[id])
+        throw std::out_of_range("no pattern with id " + std::to_string(id));
+
+    this->m_removed[id] = true;
+    this->m_fragments[id].reset();
+
+    if (id < this->m_base_end)
+        this->m_base_removed++;
+}
+
+/**
+ * @brief
+ * Compiles the patterns added since the last full rebuild into the delta
+ * level, or rebuilds the whole set when the delta is too large or the base
+ * holds too many tombstones
+ * @throws std::length_error if the delta DFA or its unanchored table
+ * exceeds MATCHER_SEARCH_STATE_BUDGET states
+ */
+void PatternSet::compile()
+{
+    std::vector<int> delta = this->live_ids(this->m_base_end);
+
+    if (!this->m_matcher || delta.size() > PATTERN_SET_MAX_DELTA ||
+        2 * this->m_base_removed > this->m_base_size)
+    {
+        this->rebuild();
+        return;
+    }
+
+    std::unique_ptr<Matcher> matcher;
+
+    if (!delta.empty())
+    {
+        Minimizer minimizer;
+        std::shared_ptr<Graph> nfa = this->unite(delta);
+
+        matcher = std::make_unique<Matcher>(*minimizer.minimize(
+            *Automata::determinize(*nfa, ByteClasses(*nfa),
+                                   MATCHER_SEARCH_STATE_BUDGET)));
+    }
+
+    this->m_delta_count = delta.size();
+    this->m_delta_matcher = std::move(matcher);
+
+    this->m_compiled = true;
+}
+
+/**
+ * @brief
+ * Compiles every live pattern into one minimal DFA whose final states carry
+ * the ids of the patterns they accept, emptying the delta level. The set
+ * is left as it was if compiling fails.
+ * @throws std::length_error if the DFA or its unanchored table exceeds
+ * MATCHER_SEARCH_STATE_BUDGET states
+ */
+void PatternSet::rebuild()
+{
+    std::vector<int> ids = this->live_ids(0);
+    std::shared_ptr<Graph> nfa = this->unite(ids);
+
+    Minimizer minimizer;
+    std::shared_ptr<Graph> dfa =
+        minimizer.minimize(*Automata::determinize(
+            *nfa, ByteClasses(*nfa), MATCHER_SEARCH_STATE_BUDGET));
+    std::unique_ptr<Matcher> matcher = std::make_unique<Matcher>(*dfa);
+
+    this->m_nfa = std::move(nfa);
+    this->m_dfa = std::move(dfa);
+    this->m_matcher = std::move(matcher);
+
+    this->m_base_end = static_cast<int>(this->m_patterns.size());
+    this->m_base_size = ids.size();
+    this->m_base_removed = 0;
+    this->m_delta_count = 0;
+    this->m_delta_matcher.reset();
+    this->m_compiled = true;
+}
+
+/**
+ * @brief
+ * Finds the patterns matching the whole input
+ * @param input Input to be matched
+ * @return std::vector<int> sorted ids of the matching patterns
+ */
+std::vector<int> PatternSet::match(std::string_view input) const
+{
+    if (!this->is_compiled())
+        throw std::logic_error("PatternSet::match called before compile");
+
+    return this->filter(this->m_matcher->match_ids(input),
+                        this->m_delta_matcher
+                            ? this->m_delta_matcher->match_ids(input)
+                            : std::vector<int>());
+}
+
+/**
+ * @brief
+ * Finds the patterns matching anywhere in the input, in one pass per level
+ * @param input Input to be scanned
+ * @return std::vector<int> sorted ids of the matching patterns
+ */
+std::vector<int> PatternSet::scan(std::string_view input) const
+{
+    if (!this->is_compiled())
+        throw std::logic_error("PatternSet::scan called before compile");
+
+    return this->filter(this->m_matcher->scan_ids(input),
+                        this->m_delta_matcher
+                            ? this->m_delta_matcher->scan_ids(input)
+                            : std::vector<int>());
+}
+
+// Methods (private)
+/**
+ * @brief
+ * Lists the patterns that were not removed
+ * @param from Smallest id to be listed
+ * @return std::vector<int> ids from the given one on, in increasing order
+ */
+std::vector<int> PatternSet::live_ids(const int &from) const
+{
+    std::vector<int> ids;
+
+    for (int id = from; id < static_cast<int>(this->m_patterns.size()); id++)
+        if (!this->m_removed[id])
+            ids.push_back(id);
+
+    return ids;
+}
+
+/**
+ * @brief
+ * Hangs the NFAs of some patterns from one start vertex, each final vertex
+ * carrying the id of its pattern
+ * @param ids Patterns to be united
+ * @return std::shared_ptr<Graph> union NFA, frozen
+ */
+std::shared_ptr<Graph> PatternSet::unite(const std::vector<int> &ids) const
+{
+    std::shared_ptr<Graph> nfa = std::make_shared<Graph>();
+    nfa->set_start(nfa->create_vertex());
+
+    for (const int &id : ids)
+    {
+        auto [start, final] = nfa->connect_graph_to_vertex(
+            this->m_fragments[id], nfa->get_start());
+
+        nfa->add_final(final, id);
+    }
+
+    nfa->freeze();
+    return nfa;
+}
+
+/**
+ * @brief
+ * Merges the ids reported by both levels and drops removed patterns
+ * @param base Sorted ids reported by the base level
+ * @param delta Sorted ids reported by the delta level
+ * @return std::vector<int> sorted ids of live patterns
+ */
+std::vector<int> PatternSet::filter(std::vector<int> base,
+                                    const std::vector<int> &delta) const
+{
+    base.insert(base.end(), delta.begin(), delta.end());
+    std::inplace_merge(base.begin(), base.end() - delta.size(), base.end());
+
+    base.erase(std::remove_if(base.begin(), base.end(), [this](const int &id)
+                              { return this->m_removed[id]; }),
+               base.end());
+
+    return base;
+}
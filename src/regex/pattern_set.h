@@ -0,0 +1,98 @@
+/**
+ * @file pattern_set.h
+ * @author Carlos Salguero
+ * @brief Declaration of the PatternSet class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef PATTERN_SET_H
+#define PATTERN_SET_H
+
+// C++ Standard Library
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Project files
+#include "../graph/graph.h"
+#include "../matcher/matcher.h"
+
+// Constants
+constexpr std::size_t PATTERN_SET_MAX_DELTA = 32;
+
+// Class
+/**
+ * @class PatternSet
+ * @brief Many regular expressions compiled into a single DFA.
+ *
+ * Every pattern gets the id returned by add. The NFAs of all the patterns
+ * hang from one start vertex and each final vertex carries the id of its
+ * pattern, so one pass over the input reports every pattern that matched.
+ *
+ * Updates are incremental. Every pattern is compiled to its own NFA when
+ * added, and the set is kept in two levels: a base DFA of the patterns of
+ * the last full rebuild and a small delta DFA of the patterns added since,
+ * so compile only determinizes the delta. Removing a pattern leaves a
+ * tombstone whose id is filtered from the results at once. A full rebuild
+ * happens when the delta grows past PATTERN_SET_MAX_DELTA patterns or
+ * tombstones make up half of the base. Either level is determinized within
+ * MATCHER_SEARCH_STATE_BUDGET states, and compiling throws
+ * std::length_error past it.
+ */
+class PatternSet
+{
+public:
+    // Constructors
+    PatternSet() = default;
+
+    // Destructor
+    ~PatternSet() = default;
+
+    // Access Methods
+    std::size_t size() const;
+    const std::string &get_pattern(const int &) const;
+    const std::shared_ptr<Graph> &get_nfa() const;
+    const std::shared_ptr<Graph> &get_dfa() const;
+    std::size_t get_delta_count() const;
+    bool is_compiled() const;
+    bool is_removed(const int &) const;
+
+    // Methods
+    int add(const std::string &);
+    void remove(const int &);
+    void compile();
+    void rebuild();
+    std::vector<int> match(std::string_view) const;
+    std::vector<int> scan(std::string_view) const;
+
+private:
+    std::vector<std::string> m_patterns;
+    std::vector<std::shared_ptr<Graph>> m_fragments;
+    std::vector<bool> m_removed;
+    bool m_compiled = false;
+
+    // Base level, the patterns below m_base_end at the last full rebuild
+    int m_base_end = 0;
+    std::size_t m_base_size = 0;
+    std::size_t m_base_removed = 0;
+    std::shared_ptr<Graph> m_nfa;
+    std::shared_ptr<Graph> m_dfa;
+    std::unique_ptr<Matcher> m_matcher;
+
+    // Delta level, the live patterns from m_base_end on
+    std::size_t m_delta_count = 0;
+    std::unique_ptr<Matcher> m_delta_matcher;
+
+    // Methods
+    std::vector<int> live_ids(const int &) const;
+    std::shared_ptr<Graph> unite(const std::vector<int> &) const;
+    std::vector<int> filter(std::vector<int>, const std::vector<int> &) const;
+};
+
+#endif //! PATTERN_SET_H
@@ -0,0 +1,247 @@
+/**
+ * @file regex.cpp
+ * @author Carlos Salguero
+ * @brief Implementation of the Regex class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+// C++ Standard Library
+#include <stdexcept>
+
+// Project files
+#include "regex.h"
+#include "../automata/automata.h"
+#include "../automata/literal_analyzer.h"
+#include "../automata/minimizer.h"
+
+// Constructors
+/**
+ * @brief
+ * Construct a new Regex:: Regex object, compiling the expression
+ * @param expression Regular expression
+ * @param max_dfa_states Largest number of states of either table of the
+ * DFA engine before the lazy engine is chosen instead
+ */
+Regex::Regex(const std::string &expression, const std::size_t &max_dfa_states)
+    : m_expression(expression), m_prefilter("")
+{
+    Automata automata(expression);
+    this->m_nfa = automata.build();
+
+    LiteralAnalyzer literals(*this->m_nfa);
+    this->m_prefilter = Prefilter(literals.get_required());
+    this->m_prefilter_is_prefix =
+        !literals.get_prefix().empty() &&
+        literals.get_prefix() == literals.get_required();
+
+    if (BitParallelMatcher::fits(*this->m_nfa))
+    {
+        this->m_engine = Engine::BIT_PARALLEL;
+        this->m_bit_parallel =
+            std::make_shared<const BitParallelMatcher>(*this->m_nfa);
+
+        return;
+    }
+
+    try
+    {
+        Minimizer minimizer;
+        std::shared_ptr<Graph> dfa = Automata::determinize(
+            *this->m_nfa, ByteClasses(*this->m_nfa), max_dfa_states);
+
+        this->m_matcher = std::make_shared<const Matcher>(
+            *minimizer.minimize(*dfa), max_dfa_states);
+        this->m_engine = Engine::DFA;
+    }
+
+    catch (const std::length_error &)
+    {
+        this->m_engine = Engine::LAZY_DFA;
+        this->m_lazy_dfa = std::make_shared<const LazyDfa>(this->m_nfa);
+    }
+}
+
+// Access Methods
+/**
+ * @brief
+ * Get the engine the expression was compiled for
+ * @return Engine engine
+ */
+Engine Regex::get_engine() const
+{
+    return this->m_engine;
+}
+
+/**
+ * @brief
+ * Get the source expression
+ * @return const std::string& expression
+ */
+const std::string &Regex::get_expression() const
+{
+    return this->m_expression;
+}
+
+/**
+ * @brief
+ * Get the Thompson NFA of the expression
+ * @return const std::shared_ptr<Graph>& NFA
+ */
+const std::shared_ptr<Graph> &Regex::get_nfa() const
+{
+    return this->m_nfa;
+}
+
+/**
+ * @brief
+ * Get the prefilter searching the longest literal every match contains
+ * @return const Prefilter& prefilter, empty if the expression has no
+ * required literal
+ */
+const Prefilter &Regex::get_prefilter() const
+{
+    return this->m_prefilter;
+}
+
+/**
+ * @brief
+ * Get an estimate of the memory held by the compiled expression
+ * @return std::size_t size in bytes of the NFA, the prefilter and the
+ * engine, the lazy one without the caches of its scratches
+ */
+std::size_t Regex::get_memory_usage() const
+{
+    std::size_t usage = sizeof(Regex) + this->m_expression.size() +
+                        this->m_prefilter.get_literal().size() +
+                        this->m_nfa->get_memory_usage();
+
+    switch (this->m_engine)
+    {
+    case Engine::BIT_PARALLEL:
+        return usage + this->m_bit_parallel->get_memory_usage();
+
+    case Engine::DFA:
+        return usage + this->m_matcher->get_memory_usage();
+
+    default:
+        return usage + this->m_lazy_dfa->get_memory_usage();
+    }
+}
+
+// Methods
+/**
+ * @brief
+ * Checks if the whole input matches the expression
+ * @param input Input to be matched
+ * @return true if the input matches
+ */
+bool Regex::match(std::string_view input) const
+{
+    MatchScratch scratch;
+    return this->match(input, scratch);
+}
+
+/**
+ * @brief
+ * Checks if the whole input matches the expression, with the state cache
+ * of the calling thread
+ * @param input Input to be matched
+ * @param scratch Scratch of the calling thread
+ * @return true if the input matches
+ */
+bool Regex::match(std::string_view input, MatchScratch &scratch) const
+{
+    switch (this->m_engine)
+    {
+    case Engine::BIT_PARALLEL:
+        return this->m_bit_parallel->match(input);
+
+    case Engine::DFA:
+        return this->m_matcher->match(input);
+
+    default:
+        return scratch.get_lazy_dfa(this->m_lazy_dfa).match(input);
+    }
+}
+
+/**
+ * @brief
+ * Searches the input for the first position where a match ends
+ * @param input Input to be searched
+ * @return std::optional<std::size_t> end offset of the earliest ending
+ * match, empty if there is no match
+ */
+std::optional<std::size_t> Regex::find(std::string_view input) const
+{
+    MatchScratch scratch;
+    return this->find(input, scratch);
+}
+
+/**
+ * @brief
+ * Searches the input for the first position where a match ends, with the
+ * state cache of the calling thread
+ * @param input Input to be searched
+ * @param scratch Scratch of the calling thread
+ * @return std::optional<std::size_t> end offset of the earliest ending
+ * match, empty if there is no match
+ */
+std::optional<std::size_t> Regex::find(std::string_view input,
+                                       MatchScratch &scratch) const
+{
+    std::size_t from = this->m_prefilter.find(input);
+
+    if (from == std::string_view::npos)
+        return std::nullopt;
+
+    // Matches start with the literal, so none starts before it
+    if (!this->m_prefilter_is_prefix)
+        from = 0;
+
+    std::optional<std::size_t> end;
+    std::string_view rest = input.substr(from);
+
+    switch (this->m_engine)
+    {
+    case Engine::BIT_PARALLEL:
+        end = this->m_bit_parallel->find(rest);
+        break;
+
+    case Engine::DFA:
+        end = this->m_matcher->find(rest);
+        break;
+
+    default:
+        end = scratch.get_lazy_dfa(this->m_lazy_dfa).find(rest);
+        break;
+    }
+
+    if (end.has_value())
+        return from + *end;
+
+    return std::nullopt;
+}
+
+// Methods (MatchScratch)
+/**
+ * @brief
+ * Get the lazy DFA of this scratch for a prototype, copying the prototype
+ * first unless the scratch already holds a copy of it
+ * @param prototype Lazy DFA of the compiled expression
+ * @return LazyDfa& copy owned by the scratch
+ */
+LazyDfa &MatchScratch::get_lazy_dfa(
+    const std::shared_ptr<const LazyDfa> &prototype)
+{
+    if (this->m_prototype != prototype)
+    {
+        this->m_lazy_dfa = std::make_unique<LazyDfa>(*prototype);
+        this->m_prototype = prototype;
+    }
+
+    return *this->m_lazy_dfa;
+}
@@ -0,0 +1,131 @@
+/**
+ * @file regex.h
+ * @author Carlos Salguero
+ * @brief Declaration of the Regex class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef REGEX_H
+#define REGEX_H
+
+// C++ Standard Library
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+
+// Project files
+#include "../graph/graph.h"
+#include "../matcher/bit_parallel_matcher.h"
+#include "../matcher/lazy_dfa.h"
+#include "../matcher/matcher.h"
+#include "../matcher/prefilter.h"
+
+// Constants
+constexpr std::size_t REGEX_DFA_STATE_BUDGET = 10000;
+
+// Enums
+/**
+ * @enum Engine
+ * @brief Matching engine chosen for a compiled expression
+ */
+enum class Engine
+{
+    BIT_PARALLEL,
+    DFA,
+    LAZY_DFA
+};
+
+// Class
+/**
+ * @class MatchScratch
+ * @brief Mutable state one thread needs to match with a Regex. Only the
+ * lazy engine uses it, copying its prototype on first use so that every
+ * scratch has a state cache of its own; the other engines leave it empty.
+ */
+class MatchScratch
+{
+public:
+    // Constructors
+    MatchScratch() = default;
+    MatchScratch(MatchScratch &&) = default;
+
+    // Destructor
+    ~MatchScratch() = default;
+
+    // Operators
+    MatchScratch &operator=(MatchScratch &&) = default;
+
+    // Methods
+    LazyDfa &get_lazy_dfa(const std::shared_ptr<const LazyDfa> &);
+
+private:
+    std::shared_ptr<const LazyDfa> m_prototype;
+    std::unique_ptr<LazyDfa> m_lazy_dfa;
+};
+
+/**
+ * @class Regex
+ * @brief Compiled regular expression. Expressions whose NFA fits in a word
+ * run on the bit-parallel engine, every other one on the minimal DFA, or on
+ * a lazily built DFA when the tables of the full one would exceed the state
+ * budget.
+ *
+ * Inputs without the longest literal every match contains are rejected by
+ * a vectorized search before either engine runs, and when that literal
+ * starts every match the search skips straight to its first occurrence.
+ *
+ * A Regex never changes after construction, so any number of threads may
+ * match with one concurrently without locking. Copies share the compiled
+ * engines instead of duplicating them. The lazy engine keeps its cache in
+ * a MatchScratch: threads matching repeatedly should keep one each, while
+ * the calls without one start from an empty cache every time.
+ */
+class Regex
+{
+public:
+    // Constructors
+    Regex(const std::string &,
+          const std::size_t &max_dfa_states = REGEX_DFA_STATE_BUDGET);
+    Regex(const Regex &) = default;
+    Regex(Regex &&) = default;
+
+    // Destructor
+    ~Regex() = default;
+
+    // Operators
+    Regex &operator=(const Regex &) = default;
+    Regex &operator=(Regex &&) = default;
+
+    // Access Methods
+    Engine get_engine() const;
+    const std::string &get_expression() const;
+    const std::shared_ptr<Graph> &get_nfa() const;
+    const Prefilter &get_prefilter() const;
+    std::size_t get_memory_usage() const;
+
+    // Methods
+    bool match(std::string_view) const;
+    bool match(std::string_view, MatchScratch &) const;
+    std::optional<std::size_t> find(std::string_view) const;
+    std::optional<std::size_t> find(std::string_view, MatchScratch &) const;
+
+private:
+    std::string m_expression;
+    std::shared_ptr<Graph> m_nfa;
+    Engine m_engine;
+
+    Prefilter m_prefilter;
+    bool m_prefilter_is_prefix;
+
+    std::shared_ptr<const BitParallelMatcher> m_bit_parallel;
+    std::shared_ptr<const Matcher> m_matcher;
+    std::shared_ptr<const LazyDfa> m_lazy_dfa;
+};
+
+#endif //! REGEX_H
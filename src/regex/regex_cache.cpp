@@ -0,0 +1,206 @@
+/**
+ * @file regex_cache.cpp
+ * @author Carlos Salguero
+ * @brief Implementation of the RegexCache class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+// Project files
+#include "regex_cache.h"
+#include "../parser/parser.h"
+#include "../parser/simplifier.h"
+
+// Constructors
+/**
+ * @brief
+ * Construct a new RegexCache:: RegexCache object
+ * @param memory_budget Estimated memory the entries may take before the
+ * least recently used ones are evicted
+ */
+RegexCache::RegexCache(const std::size_t &memory_budget)
+    : m_memory_budget(memory_budget)
+{
+}
+
+// Access Methods
+/**
+ * @brief
+ * Get the counters and the current size of the cache
+ * @return RegexCacheStats snapshot of the counters
+ */
+RegexCacheStats RegexCache::get_stats() const
+{
+    std::lock_guard<std::mutex> lock(this->m_mutex);
+
+    RegexCacheStats stats = this->m_stats;
+    stats.entries = this->m_entries.size();
+
+    return stats;
+}
+
+/**
+ * @brief
+ * Get the memory budget
+ * @return std::size_t budget in bytes
+ */
+std::size_t RegexCache::get_memory_budget() const
+{
+    std::lock_guard<std::mutex> lock(this->m_mutex);
+    return this->m_memory_budget;
+}
+
+// Mutator Methods
+/**
+ * @brief
+ * Set the memory budget, evicting entries until the cache fits it
+ * @param memory_budget budget in bytes
+ */
+void RegexCache::set_memory_budget(const std::size_t &memory_budget)
+{
+    std::lock_guard<std::mutex> lock(this->m_mutex);
+
+    this->m_memory_budget = memory_budget;
+    this->evict();
+}
+
+// Methods (public)
+/**
+ * @brief
+ * Get the cache shared by the whole process
+ * @return RegexCache& process-wide cache with the default budget
+ */
+RegexCache &RegexCache::global()
+{
+    static RegexCache cache;
+    return cache;
+}
+
+/**
+ * @brief
+ * Get the compiled form of an expression, compiling it only if neither its
+ * text nor its simplified form is cached
+ * @param expression Regular expression
+ * @param max_dfa_states DFA state budget the expression is compiled with
+ * @return std::shared_ptr<const Regex> compiled expression, whose source is
+ * the first spelling compiled
+ * @throws std::invalid_argument if the expression is malformed
+ */
+std::shared_ptr<const Regex> RegexCache::get(const std::string &expression,
+                                             const std::size_t &max_dfa_states)
+{
+    const std::string options = '\0' + std::to_string(max_dfa_states);
+    const std::string alias = expression + options;
+
+    {
+        std::lock_guard<std::mutex> lock(this->m_mutex);
+        auto it = this->m_index.find(alias);
+
+        if (it != this->m_index.end())
+        {
+            this->m_stats.hits++;
+            return this->touch(it->second, alias);
+        }
+    }
+
+    const std::string key =
+        Simplifier(Parser(expression).parse()).simplify().to_string() +
+        options;
+
+    {
+        std::lock_guard<std::mutex> lock(this->m_mutex);
+        auto it = this->m_index.find(key);
+
+        if (it != this->m_index.end())
+        {
+            this->m_stats.hits++;
+            return this->touch(it->second, alias);
+        }
+    }
+
+    std::shared_ptr<const Regex> regex =
+        std::make_shared<const Regex>(expression, max_dfa_states);
+
+    std::lock_guard<std::mutex> lock(this->m_mutex);
+    this->m_stats.misses++;
+
+    // Another thread may have compiled the same expression meanwhile
+    auto it = this->m_index.find(key);
+
+    if (it != this->m_index.end())
+        return this->touch(it->second, alias);
+
+    this->m_entries.push_front(
+        {key, {}, regex, sizeof(Entry) + key.size() + regex->get_memory_usage()});
+    this->m_index.emplace(key, this->m_entries.begin());
+    this->m_stats.memory_usage += this->m_entries.front().memory_usage;
+
+    return this->touch(this->m_entries.begin(), alias);
+}
+
+/**
+ * @brief
+ * Drops every entry, keeping the counters. Handles already given out stay
+ * valid.
+ */
+void RegexCache::clear()
+{
+    std::lock_guard<std::mutex> lock(this->m_mutex);
+
+    this->m_index.clear();
+    this->m_entries.clear();
+    this->m_stats.memory_usage = 0;
+}
+
+// Methods (private)
+/**
+ * @brief
+ * Marks an entry as the most recently used and remembers the exact text it
+ * was looked up with. The lock must be held.
+ * @param entry Entry being used
+ * @param alias Exact text and options of the lookup
+ * @return std::shared_ptr<const Regex> compiled expression of the entry
+ */
+std::shared_ptr<const Regex> RegexCache::touch(
+    const std::list<Entry>::iterator &entry, const std::string &alias)
+{
+    this->m_entries.splice(this->m_entries.begin(), this->m_entries, entry);
+
+    if (this->m_index.emplace(alias, entry).second)
+    {
+        entry->aliases.push_back(alias);
+        entry->memory_usage += alias.size();
+        this->m_stats.memory_usage += alias.size();
+    }
+
+    std::shared_ptr<const Regex> regex = entry->regex;
+    this->evict();
+
+    return regex;
+}
+
+/**
+ * @brief
+ * Evicts the least recently used entries until the cache fits its budget,
+ * always keeping the most recent one. The lock must be held.
+ */
+void RegexCache::evict()
+{
+    while (this->m_stats.memory_usage > this->m_memory_budget &&
+           this->m_entries.size() > 1)
+    {
+        Entry &entry = this->m_entries.back();
+
+        this->m_index.erase(entry.key);
+
+        for (const std::string &alias : entry.aliases)
+            this->m_index.erase(alias);
+
+        this->m_stats.memory_usage -= entry.memory_usage;
+        this->m_stats.evictions++;
+        this->m_entries.pop_back();
+    }
+}
@@ -0,0 +1,116 @@
+/**
+ * @file regex_cache.h
+ * @author Carlos Salguero
+ * @brief Declaration of the RegexCache class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef REGEX_CACHE_H
+#define REGEX_CACHE_H
+
+// C++ Standard Library
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Project files
+#include "regex.h"
+
+// Constants
+constexpr std::size_t REGEX_CACHE_DEFAULT_BUDGET = std::size_t(64) << 20;
+
+// Structs
+/**
+ * @struct RegexCacheStats
+ * @brief Counters and size of a RegexCache
+ */
+struct RegexCacheStats
+{
+    std::size_t hits = 0;
+    std::size_t misses = 0;
+    std::size_t evictions = 0;
+    std::size_t entries = 0;
+    std::size_t memory_usage = 0;
+};
+
+// Class
+/**
+ * @class RegexCache
+ * @brief Least recently used cache of compiled expressions, safe to use
+ * from any number of threads.
+ *
+ * Entries are keyed by the simplified form of the expression and the DFA
+ * state budget, so spellings such as `a|b` and `[ab]` share one compiled
+ * Regex. The exact text of every expression looked up is remembered as
+ * well, so a repeated lookup is one hash lookup without parsing.
+ *
+ * The least recently used entries are evicted while the estimated memory
+ * of the cache exceeds its budget. Handles are shared pointers to
+ * immutable Regex objects, so an evicted entry stays valid for as long as
+ * someone holds it. Compilation runs outside the lock.
+ */
+class RegexCache
+{
+public:
+    // Constructors
+    RegexCache(const std::size_t &memory_budget = REGEX_CACHE_DEFAULT_BUDGET);
+    RegexCache(const RegexCache &) = delete;
+
+    // Destructor
+    ~RegexCache() = default;
+
+    // Operators
+    RegexCache &operator=(const RegexCache &) = delete;
+
+    // Access Methods
+    RegexCacheStats get_stats() const;
+    std::size_t get_memory_budget() const;
+
+    // Mutator Methods
+    void set_memory_budget(const std::size_t &);
+
+    // Methods
+    static RegexCache &global();
+
+    std::shared_ptr<const Regex> get(
+        const std::string &,
+        const std::size_t &max_dfa_states = REGEX_DFA_STATE_BUDGET);
+    void clear();
+
+private:
+    /**
+     * @struct Entry
+     * @brief Compiled expression with its key, the exact texts that led to
+     * it and its estimated memory
+     */
+    struct Entry
+    {
+        std::string key;
+        std::vector<std::string> aliases;
+        std::shared_ptr<const Regex> regex;
+        std::size_t memory_usage;
+    };
+
+    mutable std::mutex m_mutex;
+    std::size_t m_memory_budget;
+
+    // Most recently used first, indexed by key and by alias
+    std::list<Entry> m_entries;
+    std::unordered_map<std::string, std::list<Entry>::iterator> m_index;
+    RegexCacheStats m_stats;
+
+    // Methods
+    std::shared_ptr<const Regex> touch(const std::list<Entry>::iterator &,
+                                       const std::string &);
+    void evict();
+};
+
+#endif //! REGEX_CACHE_H
@@ -0,0 +1,611 @@
+/**
+ * @file static_regex.h
+ * @author Carlos Salguero
+ * @brief Declaration of the StaticRegex class, a regular expression
+ * compiled to a DFA while the program is being compiled
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef STATIC_REGEX_H
+#define STATIC_REGEX_H
+
+// C++ Standard Library
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+// Project files
+#include "../graph/graph.h"
+#include "../automata/automata.h"
+#include "../parser/ast.h"
+#include "../parser/parser.h"
+#include "../parser/simplifier.h"
+
+// Structs
+/**
+ * @struct FixedString
+ * @brief String literal usable as a template argument
+ */
+template <std::size_t N>
+struct FixedString
+{
+    char value[N] = {};
+
+    constexpr FixedString(const char (&string)[N])
+    {
+        for (std::size_t i = 0; i < N; i++)
+            this->value[i] = string[i];
+    }
+
+    constexpr std::string_view view() const
+    {
+        return std::string_view(this->value, N - 1);
+    }
+};
+
+/**
+ * @struct StaticShape
+ * @brief Number of rows and columns of a static table, dead row included
+ */
+struct StaticShape
+{
+    std::size_t states;
+    std::size_t classes;
+};
+
+/**
+ * @struct StaticTable
+ * @brief Transition table of a StaticRegex. As in Matcher, states are
+ * premultiplied by the row length and row 0 is the dead state; they are
+ * stored in the smallest type that fits.
+ */
+template <std::size_t States, std::size_t Classes>
+struct StaticTable
+{
+    using State = std::conditional_t<
+        (States * Classes <= 0x100), std::uint8_t,
+        std::conditional_t<(States * Classes <= 0x10000), std::uint16_t,
+                           std::uint32_t>>;
+
+    std::array<std::uint8_t, BYTE_VALUES> classes = {};
+    std::array<State, States * Classes> table = {};
+    std::array<bool, States> accepting = {};
+    State start = 0;
+};
+
+// Class
+/**
+ * @class StaticCompiler
+ * @brief Builds the Thompson NFA of an expression with the same parser and
+ * simplifier as Automata::build and determinizes it, inside constant
+ * evaluation. Every container is transient, so only the packed tables
+ * outlive compilation.
+ */
+class StaticCompiler
+{
+public:
+    // Constructors
+    /**
+     * @brief
+     * Compiles an expression into a DFA table
+     * @param expression Regular expression
+     * @param search true to inject the start state at every position, as
+     * Matcher does for find
+     */
+    constexpr StaticCompiler(std::string_view expression, const bool &search)
+    {
+        this->build(expression);
+        this->classify();
+        this->determinize(search);
+    }
+
+    // Access Methods
+    /**
+     * @brief
+     * Get the size of the table
+     * @return StaticShape rows and columns
+     */
+    constexpr StaticShape get_shape() const
+    {
+        return {this->m_accepting.size(),
+                static_cast<std::size_t>(this->m_class_count)};
+    }
+
+    /**
+     * @brief
+     * Copies the table into fixed-size storage of its own shape
+     * @param table Destination table
+     */
+    template <std::size_t States, std::size_t Classes>
+    constexpr void pack(StaticTable<States, Classes> &table) const
+    {
+        using State = typename StaticTable<States, Classes>::State;
+
+        table.classes = this->m_classes;
+        table.start = static_cast<State>(this->m_start * Classes);
+
+        for (std::size_t i = 0; i < States * Classes; i++)
+            table.table[i] = static_cast<State>(this->m_table[i] * Classes);
+
+        for (std::size_t i = 0; i < States; i++)
+            table.accepting[i] = this->m_accepting[i];
+    }
+
+private:
+    // NFA
+    std::vector<Edge> m_edges;
+    int m_vertexes = 0;
+    int m_nfa_start = 0;
+    int m_nfa_final = 0;
+
+    // Byte classes
+    std::array<std::uint8_t, BYTE_VALUES> m_classes = {};
+    std::vector<unsigned char> m_representatives;
+    int m_class_count = 0;
+
+    // DFA, row 0 is the dead state
+    std::vector<int> m_table;
+    std::vector<char> m_accepting;
+    int m_start = 0;
+
+    // Methods
+    /**
+     * @brief
+     * Builds the Thompson NFA of the simplified syntax tree, as
+     * Automata::build does
+     * @param expression Regular expression
+     */
+    constexpr void build(std::string_view expression)
+    {
+        Ast ast = Simplifier(Parser(expression).parse()).simplify();
+        Fragment fragment = this->emit(ast, ast.get_root());
+
+        this->m_nfa_start = fragment.start;
+        this->m_nfa_final = fragment.end;
+    }
+
+    /**
+     * @brief
+     * Builds the fragment of a subtree of the syntax tree
+     * @param ast Syntax tree
+     * @param index Index of the subtree
+     * @return Fragment Fragment of the subtree
+     */
+    constexpr Fragment emit(const Ast &ast, const int &index)
+    {
+        const Node &node = ast.get_node(index);
+
+        if (node.type == NodeType::CONCAT)
+        {
+            Fragment fragment = this->emit(ast, node.children[0]);
+
+            for (std::size_t i = 1; i < node.children.size(); i++)
+            {
+                Fragment next = this->emit(ast, node.children[i]);
+
+                this->epsilon(fragment.end, next.start);
+                fragment.end = next.end;
+            }
+
+            return fragment;
+        }
+
+        if (node.type == NodeType::REPEAT)
+        {
+            int first_vertex = this->m_vertexes;
+            std::size_t first_edge = this->m_edges.size();
+            Fragment operand = this->emit(ast, node.children[0]);
+
+            return this->repeat(operand, first_vertex, first_edge, node.min,
+                                node.max);
+        }
+
+        int start = this->m_vertexes++;
+        int end = this->m_vertexes++;
+
+        switch (node.type)
+        {
+        case NodeType::ALTERNATE:
+            for (const int &child : node.children)
+            {
+                Fragment alternative = this->emit(ast, child);
+
+                this->epsilon(start, alternative.start);
+                this->epsilon(alternative.end, end);
+            }
+
+            break;
+
+        case NodeType::STAR:
+        case NodeType::PLUS:
+        {
+            Fragment repeated = this->emit(ast, node.children[0]);
+
+            this->epsilon(start, repeated.start);
+            this->epsilon(repeated.end, repeated.start);
+            this->epsilon(repeated.end, end);
+
+            if (node.type == NodeType::STAR)
+                this->epsilon(start, end);
+
+            break;
+        }
+
+        case NodeType::LITERAL:
+        {
+            unsigned char byte = static_cast<unsigned char>(node.symbol);
+
+            this->m_edges.push_back({start, byte, byte, end});
+            break;
+        }
+
+        case NodeType::CLASS:
+            for (const ByteRange &range : node.set.ranges())
+                this->m_edges.push_back({start, range.low, range.high, end});
+
+            break;
+
+        default:
+            this->epsilon(start, end);
+            break;
+        }
+
+        return {start, end};
+    }
+
+    /**
+     * @brief
+     * Applies a counted repetition to the last fragment built, copying its
+     * block of vertexes and edges as Automata::repeat does
+     * @param fragment Fragment of the operand
+     * @param first_vertex First vertex of the operand's block
+     * @param first_edge First edge of the operand's block
+     * @param min Smallest number of repetitions
+     * @param max Largest number of repetitions, REPEAT_UNBOUNDED for none
+     * @return Fragment Fragment of the repetition
+     */
+    constexpr Fragment repeat(const Fragment &fragment, const int &first_vertex,
+                              const std::size_t &first_edge, const int &min,
+                              const int &max)
+    {
+        const int vertexes = this->m_vertexes - first_vertex;
+        const std::size_t edges = this->m_edges.size() - first_edge;
+        const int copies =
+            max == REPEAT_UNBOUNDED ? (min > 1 ? min : 1) : max;
+
+        int start = this->m_vertexes++;
+        int end = this->m_vertexes++;
+        Fragment previous = {start, start};
+
+        for (int copy = 0; copy < copies; copy++)
+        {
+            Fragment current = fragment;
+
+            if (copy > 0)
+            {
+                int offset = this->m_vertexes - first_vertex;
+                this->m_vertexes += vertexes;
+
+                for (std::size_t i = 0; i < edges; i++)
+                {
+                    Edge edge = this->m_edges[first_edge + i];
+
+                    edge.from += offset;
+                    edge.to += offset;
+                    this->m_edges.push_back(edge);
+                }
+
+                current = {fragment.start + offset, fragment.end + offset};
+            }
+
+            this->epsilon(previous.end, current.start);
+
+            if (copy >= min)
+                this->epsilon(current.start, end);
+
+            previous = current;
+        }
+
+        if (max == REPEAT_UNBOUNDED)
+            this->epsilon(previous.end, previous.start);
+
+        this->epsilon(previous.end, end);
+
+        return {start, end};
+    }
+
+    /**
+     * @brief
+     * Adds an epsilon edge to the NFA
+     * @param from Origin vertex
+     * @param to Destination vertex
+     */
+    constexpr void epsilon(const int &from, const int &to)
+    {
+        this->m_edges.push_back({from, 0, 0, to, true});
+    }
+
+    /**
+     * @brief
+     * Splits the bytes at the bounds of every edge and gives the same class
+     * to the pieces held by the same edges, numbered in byte order. The
+     * smallest byte of each class stands for it while determinizing.
+     */
+    constexpr void classify()
+    {
+        std::array<bool, BYTE_VALUES> bounds = {};
+        bounds[0] = true;
+
+        for (const Edge &edge : this->m_edges)
+        {
+            if (edge.epsilon)
+                continue;
+
+            bounds[edge.low] = true;
+
+            if (edge.high + 1 < BYTE_VALUES)
+                bounds[edge.high + 1] = true;
+        }
+
+        std::vector<std::vector<char>> signatures;
+
+        for (int byte = 0; byte < BYTE_VALUES; byte++)
+        {
+            if (!bounds[byte])
+            {
+                this->m_classes[byte] = this->m_classes[byte - 1];
+                continue;
+            }
+
+            std::vector<char> signature;
+
+            for (const Edge &edge : this->m_edges)
+                signature.push_back(!edge.epsilon && edge.low <= byte &&
+                                    byte <= edge.high);
+
+            std::size_t class_id = 0;
+
+            while (class_id < signatures.size() &&
+                   signatures[class_id] != signature)
+                class_id++;
+
+            if (class_id == signatures.size())
+            {
+                signatures.push_back(signature);
+                this->m_representatives.push_back(
+                    static_cast<unsigned char>(byte));
+            }
+
+            this->m_classes[byte] = static_cast<std::uint8_t>(class_id);
+        }
+
+        this->m_class_count = static_cast<int>(signatures.size());
+    }
+
+    /**
+     * @brief
+     * Adds the epsilon closure of a set to itself
+     * @param set Set of NFA vertexes, one flag per vertex
+     */
+    constexpr void close(std::vector<char> &set) const
+    {
+        std::vector<int> stack;
+
+        for (int vertex = 0; vertex < this->m_vertexes; vertex++)
+            if (set[vertex])
+                stack.push_back(vertex);
+
+        while (!stack.empty())
+        {
+            int vertex = stack.back();
+            stack.pop_back();
+
+            for (const Edge &edge : this->m_edges)
+                if (edge.from == vertex && edge.epsilon &&
+                    !set[edge.to])
+                {
+                    set[edge.to] = 1;
+                    stack.push_back(edge.to);
+                }
+        }
+    }
+
+    /**
+     * @brief
+     * Subset construction over the byte classes
+     * @param search true to inject the start set at every position
+     */
+    constexpr void determinize(const bool &search)
+    {
+        const std::size_t stride = this->m_class_count;
+
+        std::vector<std::vector<char>> subsets;
+        std::vector<char> initial(this->m_vertexes, 0);
+
+        initial[this->m_nfa_start] = 1;
+        this->close(initial);
+
+        // Row 0 is the dead state
+        subsets.push_back(std::vector<char>(this->m_vertexes, 0));
+        subsets.push_back(initial);
+        this->m_start = 1;
+
+        for (std::size_t current = 1; current < subsets.size(); current++)
+        {
+            this->m_table.resize(subsets.size() * stride, 0);
+
+            for (std::size_t class_id = 0; class_id < stride; class_id++)
+            {
+                std::vector<char> next(this->m_vertexes, 0);
+                bool empty = true;
+
+                const unsigned char byte = this->m_representatives[class_id];
+
+                for (const Edge &edge : this->m_edges)
+                    if (!edge.epsilon && subsets[current][edge.from] &&
+                        edge.low <= byte && byte <= edge.high)
+                    {
+                        next[edge.to] = 1;
+                        empty = false;
+                    }
+
+                if (search)
+                {
+                    for (int vertex = 0; vertex < this->m_vertexes; vertex++)
+                        next[vertex] = next[vertex] || initial[vertex];
+
+                    empty = false;
+                }
+
+                if (empty)
+                    continue;
+
+                this->close(next);
+
+                std::size_t target = 1;
+
+                while (target < subsets.size() && subsets[target] != next)
+                    target++;
+
+                if (target == subsets.size())
+                {
+                    subsets.push_back(next);
+                    this->m_table.resize(subsets.size() * stride, 0);
+                }
+
+                this->m_table[current * stride + class_id] =
+                    static_cast<int>(target);
+            }
+        }
+
+        this->m_table.resize(subsets.size() * stride, 0);
+
+        for (const std::vector<char> &subset : subsets)
+            this->m_accepting.push_back(subset[this->m_nfa_final]);
+    }
+};
+
+// Functions
+/**
+ * @brief
+ * Compiles an expression into a table of the given shape
+ * @param search true for the unanchored table
+ * @return StaticTable table
+ */
+template <FixedString Pattern, StaticShape Shape>
+consteval StaticTable<Shape.states, Shape.classes> compile_static_table(
+    const bool &search)
+{
+    StaticTable<Shape.states, Shape.classes> table;
+    StaticCompiler(Pattern.view(), search).pack(table);
+
+    return table;
+}
+
+// Class
+/**
+ * @class StaticRegex
+ * @brief Regular expression compiled to a DFA during compilation of the
+ * program. The tables are constant data, so matching does no construction
+ * and no allocation, and the matcher can be evaluated in constant
+ * expressions as well. Large expressions may need a higher
+ * -fconstexpr-ops-limit.
+ */
+template <FixedString Pattern>
+class StaticRegex
+{
+public:
+    static constexpr StaticShape SHAPE =
+        StaticCompiler(Pattern.view(), false).get_shape();
+    static constexpr StaticShape SEARCH_SHAPE =
+        StaticCompiler(Pattern.view(), true).get_shape();
+
+    // Methods
+    /**
+     * @brief
+     * Checks if the whole input matches the expression
+     * @param input Input to be matched
+     * @return true if the input is accepted
+     */
+    static constexpr bool match(std::string_view input)
+    {
+        constexpr std::size_t block = 64;
+
+        std::size_t state = TABLE.start;
+        std::size_t i = 0;
+
+        while (i + block <= input.size())
+        {
+            for (std::size_t j = 0; j < block; j++)
+                state = step(TABLE, state, input[i + j]);
+
+            if (state == 0)
+                return false;
+
+            i += block;
+        }
+
+        for (; i < input.size(); i++)
+            state = step(TABLE, state, input[i]);
+
+        return TABLE.accepting[state / SHAPE.classes];
+    }
+
+    /**
+     * @brief
+     * Searches the input for the first position where a match ends
+     * @param input Input to be searched
+     * @return std::optional<std::size_t> end offset of the earliest ending
+     * match, empty if there is no match
+     */
+    static constexpr std::optional<std::size_t> find(std::string_view input)
+    {
+        std::size_t state = SEARCH_TABLE.start;
+
+        if (SEARCH_TABLE.accepting[state / SEARCH_SHAPE.classes])
+            return 0;
+
+        for (std::size_t i = 0; i < input.size(); i++)
+        {
+            state = step(SEARCH_TABLE, state, input[i]);
+
+            if (SEARCH_TABLE.accepting[state / SEARCH_SHAPE.classes])
+                return i + 1;
+        }
+
+        return std::nullopt;
+    }
+
+private:
+    /**
+     * @brief
+     * Steps a table on one byte
+     * @param table Table to be stepped
+     * @param state packed state
+     * @param character input byte
+     * @return std::size_t packed next state
+     */
+    template <typename Table>
+    static constexpr std::size_t step(const Table &table,
+                                      const std::size_t &state,
+                                      const char &character)
+    {
+        return table.table[state + table.classes[static_cast<unsigned char>(
+                                       character)]];
+    }
+
+    static constexpr StaticTable<SHAPE.states, SHAPE.classes> TABLE =
+        compile_static_table<Pattern, SHAPE>(false);
+    static constexpr StaticTable<SEARCH_SHAPE.states, SEARCH_SHAPE.classes>
+        SEARCH_TABLE = compile_static_table<Pattern, SEARCH_SHAPE>(true);
+};
+
+#endif //! STATIC_REGEX_H
@@ -0,0 +1,164 @@
+/**
+ * @file automata.test.cpp
+ * @author Carlos Salguero
+ * @brief Implementation of AutomataTest class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+// Project file
+#include "automata.test.h"
+
+// Methods
+/**
+ * @brief
+ * Runs a DFA over an input
+ * @param dfa DFA to be run
+ * @param input Input to be run
+ * @return true if the DFA accepts the input
+ */
+bool AutomataTest::accepts(const Graph &dfa, const std::string &input)
+{
+    int state = dfa.get_start();
+
+    for (const char &character : input)
+    {
+        int next = -1;
+
+        for (const Transition &transition : dfa.get_edges(state))
+        {
+            if (!transition.contains(static_cast<unsigned char>(character)))
+                continue;
+
+            EXPECT_EQ(next, -1);
+            next = transition.to;
+        }
+
+        if (next == -1)
+            return false;
+
+        state = next;
+    }
+
+    return dfa.is_final(state);
+}
+
+// Tests
+// Test transform_dfa() on the expression of regex.txt
+TEST_F(AutomataTest, TransformDfaAcceptsLanguage)
+{
+    Automata automata("(a|b)*abb");
+    std::shared_ptr<Graph> dfa = automata.transform_dfa();
+
+    EXPECT_TRUE(accepts(*dfa, "abb"));
+    EXPECT_TRUE(accepts(*dfa, "aabb"));
+    EXPECT_TRUE(accepts(*dfa, "babababb"));
+    EXPECT_FALSE(accepts(*dfa, ""));
+    EXPECT_FALSE(accepts(*dfa, "ab"));
+    EXPECT_FALSE(accepts(*dfa, "abba"));
+    EXPECT_FALSE(accepts(*dfa, "abc"));
+}
+
+// Test transform_dfa() marks the start state final on nullable expressions
+TEST_F(AutomataTest, TransformDfaNullable)
+{
+    Automata automata("a*b*");
+    std::shared_ptr<Graph> dfa = automata.transform_dfa();
+
+    EXPECT_TRUE(accepts(*dfa, ""));
+    EXPECT_TRUE(accepts(*dfa, "aaabb"));
+    EXPECT_FALSE(accepts(*dfa, "ba"));
+}
+
+// Test transform_dfa() yields the textbook state count for (a|b)*abb
+TEST_F(AutomataTest, TransformDfaDeduplicatesStates)
+{
+    Automata automata("(a|b)*abb");
+    std::shared_ptr<Graph> dfa = automata.transform_dfa();
+
+    EXPECT_EQ(dfa->get_next(), 5);
+    EXPECT_EQ(dfa->get_final().size(), 1);
+}
+
+// Test transform_dfa() on the plus operator
+TEST_F(AutomataTest, TransformDfaPlus)
+{
+    Automata automata("a+b");
+    std::shared_ptr<Graph> dfa = automata.transform_dfa();
+
+    EXPECT_TRUE(accepts(*dfa, "ab"));
+    EXPECT_TRUE(accepts(*dfa, "aaab"));
+    EXPECT_FALSE(accepts(*dfa, "b"));
+}
+
+// Test concatenation binds tighter than alternation
+TEST_F(AutomataTest, TransformDfaPrecedence)
+{
+    Automata automata("ab|cd");
+    std::shared_ptr<Graph> dfa = automata.transform_dfa();
+
+    EXPECT_TRUE(accepts(*dfa, "ab"));
+    EXPECT_TRUE(accepts(*dfa, "cd"));
+    EXPECT_FALSE(accepts(*dfa, "abd"));
+    EXPECT_FALSE(accepts(*dfa, "acd"));
+}
+
+// Test classes and their negations, whose edges hold ranges of bytes
+TEST_F(AutomataTest, TransformDfaClasses)
+{
+    Automata automata("[a-z0-9]+@[^@]");
+    std::shared_ptr<Graph> dfa = automata.transform_dfa();
+
+    EXPECT_TRUE(accepts(*dfa, "user42@x"));
+    EXPECT_TRUE(accepts(*dfa, "a@\xff"));
+    EXPECT_FALSE(accepts(*dfa, "User@x"));
+    EXPECT_FALSE(accepts(*dfa, "a@@"));
+    EXPECT_FALSE(accepts(*dfa, "@x"));
+}
+
+// Test counted repetitions, whose copies grow the NFA linearly
+TEST_F(AutomataTest, TransformDfaCountedRepetition)
+{
+    Automata automata("(ab){2,3}c?");
+    std::shared_ptr<Graph> dfa = automata.transform_dfa();
+
+    EXPECT_TRUE(accepts(*dfa, "abab"));
+    EXPECT_TRUE(accepts(*dfa, "abababc"));
+    EXPECT_FALSE(accepts(*dfa, "ab"));
+    EXPECT_FALSE(accepts(*dfa, "abababab"));
+    EXPECT_FALSE(accepts(*dfa, "ababcc"));
+
+    // Two vertexes per copy of the literal plus the repetition's own two
+    EXPECT_EQ(Automata("x{1,1000}").build()->get_next(), 2002);
+    EXPECT_TRUE(accepts(*Automata("x{3,}").transform_dfa(), "xxxxxxx"));
+    EXPECT_FALSE(accepts(*Automata("x{3,}").transform_dfa(), "xx"));
+}
+
+// Test reverse() accepts the reverse of every input of the NFA
+TEST_F(AutomataTest, Reverse)
+{
+    std::shared_ptr<Graph> nfa = Automata("ab+c|d[0-9]").build();
+    std::shared_ptr<Graph> reversed = Automata::reverse(*nfa);
+    std::shared_ptr<Graph> dfa =
+        Automata::determinize(*reversed, ByteClasses(*reversed));
+
+    EXPECT_EQ(reversed->get_edge_count(), nfa->get_edge_count());
+    EXPECT_TRUE(accepts(*dfa, "cbba"));
+    EXPECT_TRUE(accepts(*dfa, "7d"));
+    EXPECT_FALSE(accepts(*dfa, "abbc"));
+    EXPECT_FALSE(accepts(*dfa, "d7"));
+}
+
+// Test an empty class matches no byte instead of the empty string
+TEST_F(AutomataTest, TransformDfaEmptyClass)
+{
+    std::shared_ptr<Graph> dfa = Automata("a[^\\x00-\\xff]b").transform_dfa();
+
+    EXPECT_FALSE(accepts(*dfa, "ab"));
+    EXPECT_FALSE(accepts(*dfa, "axb"));
+    EXPECT_FALSE(accepts(*Automata("[^\\x00-\\xff]").transform_dfa(), ""));
+    EXPECT_TRUE(accepts(*Automata("a|[^\\x00-\\xff]").transform_dfa(), "a"));
+}
@@ -0,0 +1,37 @@
+/**
+ * @file automata.test.h
+ * @author Carlos Salguero
+ * @brief Tests for Automata class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef AUTOMATA_TEST_H
+#define AUTOMATA_TEST_H
+
+// C++ Standard Library
+#include <string>
+
+// Google Test
+#include <gtest/gtest.h>
+
+// Project file
+#include "../src/automata/automata.h"
+
+// Test class
+/**
+ * @class AutomataTest
+ * @brief Tests for Automata class
+ * @extends ::testing::Test
+ */
+class AutomataTest : public ::testing::Test
+{
+protected:
+    // Methods
+    static bool accepts(const Graph &, const std::string &);
+};
+
+#endif //! AUTOMATA_TEST_H
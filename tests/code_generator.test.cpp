@@ -0,0 +1,80 @@
+/**
+ * @file code_generator.test.cpp
+ * @author Carlos Salguero
+ * @brief Implementation of CodeGeneratorTest class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+// C++ Standard Library
+#include <stdexcept>
+
+// Project file
+#include "code_generator.test.h"
+
+// Methods
+/**
+ * @brief
+ * Set up the test fixture with the minimal DFA of (a|b)*abb
+ */
+void CodeGeneratorTest::SetUp()
+{
+    Automata automata("(a|b)*abb");
+    Minimizer minimizer;
+
+    dfa = minimizer.minimize(*automata.transform_dfa());
+    source = CodeGenerator(*dfa).generate("match_abb", "(a|b)*abb");
+}
+
+/**
+ * @brief
+ * Counts the occurrences of a string in the generated source
+ * @param needle String to be counted
+ * @return std::size_t number of occurrences
+ */
+std::size_t CodeGeneratorTest::count(const std::string &needle) const
+{
+    std::size_t occurrences = 0;
+
+    for (std::size_t i = source.find(needle); i != std::string::npos;
+         i = source.find(needle, i + 1))
+        occurrences++;
+
+    return occurrences;
+}
+
+// Tests
+// Test the function is declared with the requested name
+TEST_F(CodeGeneratorTest, Signature)
+{
+    EXPECT_NE(source.find("bool match_abb(std::string_view input) noexcept"),
+              std::string::npos);
+    EXPECT_NE(source.find("// (a|b)*abb"), std::string::npos);
+}
+
+// Test every state gets one label and one switch
+TEST_F(CodeGeneratorTest, OneLabelPerState)
+{
+    for (int state = 0; state < dfa->get_next(); state++)
+        EXPECT_EQ(count("\nstate_" + std::to_string(state) + ":\n"), 1);
+
+    EXPECT_EQ(count("switch (*position++)"), dfa->get_next());
+}
+
+// Test only the final state accepts at the end of the input
+TEST_F(CodeGeneratorTest, FinalStates)
+{
+    EXPECT_EQ(count("return true;"), dfa->get_final().size());
+}
+
+// Test names that are not identifiers are rejected
+TEST_F(CodeGeneratorTest, InvalidName)
+{
+    EXPECT_THROW(CodeGenerator(*dfa).generate("1match"),
+                 std::invalid_argument);
+    EXPECT_THROW(CodeGenerator(*dfa).generate("match abb"),
+                 std::invalid_argument);
+}
@@ -0,0 +1,44 @@
+/**
+ * @file code_generator.test.h
+ * @author Carlos Salguero
+ * @brief Tests for CodeGenerator class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef CODE_GENERATOR_TEST_H
+#define CODE_GENERATOR_TEST_H
+
+// C++ Standard Library
+#include <memory>
+#include <string>
+
+// Google Test
+#include <gtest/gtest.h>
+
+// Project files
+#include "../src/automata/automata.h"
+#include "../src/automata/minimizer.h"
+#include "../src/codegen/code_generator.h"
+
+// Test class
+/**
+ * @class CodeGeneratorTest
+ * @brief Tests for CodeGenerator class
+ * @extends ::testing::Test
+ */
+class CodeGeneratorTest : public ::testing::Test
+{
+protected:
+    std::shared_ptr<Graph> dfa;
+    std::string source;
+
+    // Methods
+    void SetUp() override;
+    std::size_t count(const std::string &) const;
+};
+
+#endif //! CODE_GENERATOR_TEST_H
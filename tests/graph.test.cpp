@@ -96,4 +96,101 @@ TEST_F(GraphTest, ContainsVertex)
     EXPECT_TRUE(graph.contains_vertex(v2));
     EXPECT_TRUE(graph.contains_vertex(v3));
     EXPECT_FALSE(graph.contains_vertex(4));
-}
\ No newline at end of file
+}
+// Test freeze() keeps every edge reachable through the accessors
+TEST_F(GraphTest, FreezeKeepsEdges)
+{
+    graph.add_edge(v1, 'A', v2);
+    graph.add_edge(v1, EPSILON, v3);
+    graph.freeze();
+
+    EXPECT_TRUE(graph.is_frozen());
+    EXPECT_EQ(graph.get_edges(v1).size(), 1);
+    EXPECT_EQ(graph.get_edges(v1)[0].to, v2);
+    EXPECT_EQ(graph.get_epsilon_edges(v1).size(), 1);
+    EXPECT_EQ(graph.get_epsilon_edges(v1)[0], v3);
+    EXPECT_EQ(graph.get_edge_count(), 4);
+    EXPECT_EQ(*graph.get_weight(v2, v3), 'B');
+    EXPECT_EQ(*graph.get_weight(v1, v3), EPSILON);
+}
+
+// Test add_edge() on a frozen graph
+TEST_F(GraphTest, AddEdgeAfterFreeze)
+{
+    graph.freeze();
+    graph.add_edge(v2, 'D', v1);
+
+    EXPECT_FALSE(graph.is_frozen());
+    EXPECT_EQ(graph.get_edges(v2).size(), 2);
+    EXPECT_EQ(*graph.get_weight(v3, v1), 'C');
+}
+
+// Test ClosureTable agrees with e_closure() on epsilon cycles
+TEST_F(GraphTest, ClosureTable)
+{
+    int v4 = graph.create_vertex();
+    int v5 = graph.create_vertex();
+
+    graph.add_edge(v1, EPSILON, v2);
+    graph.add_edge(v2, EPSILON, v1);
+    graph.add_edge(v2, EPSILON, v4);
+    graph.add_edge(v4, 'D', v5);
+    graph.freeze();
+
+    ClosureTable closures(graph);
+
+    for (int vertex = v1; vertex <= v5; vertex++)
+    {
+        std::set<int> expected = graph.e_closure(vertex);
+        std::set<int> closure;
+
+        closures.for_each(vertex, [&](int member)
+                          { closure.insert(member); });
+
+        EXPECT_EQ(closure, expected);
+    }
+
+    EXPECT_EQ(closures.get_component_count(), 4);
+
+    StateSet vertexes(graph.get_next());
+    StateSet closure(graph.get_next());
+    vertexes.insert(v2);
+    vertexes.insert(v5);
+    closures.close(vertexes, closure);
+
+    EXPECT_EQ(closure.to_set(), std::set<int>({v1, v2, v4, v5}));
+}
+
+// Test closures along a chain of epsilon edges span several words
+TEST_F(GraphTest, ClosureTableChain)
+{
+    Graph chain;
+    const int length = 300;
+
+    for (int vertex = 0; vertex < length; vertex++)
+        chain.create_vertex();
+
+    for (int vertex = 0; vertex + 1 < length; vertex++)
+        chain.add_edge(vertex, EPSILON, vertex + 1);
+
+    chain.freeze();
+
+    ClosureTable closures(chain);
+    StateSet vertexes(length);
+    StateSet closure(length);
+
+    vertexes.insert(130);
+    closures.close(vertexes, closure);
+
+    EXPECT_EQ(closure.to_set().size(), std::size_t(length - 130));
+    EXPECT_FALSE(closure.contains(129));
+    EXPECT_TRUE(closure.contains(length - 1));
+
+    int count = 0;
+    closures.for_each(0, [&](int)
+                      { count++; });
+
+    EXPECT_EQ(count, length);
+    EXPECT_LT(closures.get_memory_usage(),
+              std::size_t(length) * length * sizeof(int) / 16);
+}
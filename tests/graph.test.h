@@ -16,7 +16,8 @@
 #include <gtest/gtest.h>
 
 // Project file
-#include "../src/Graph/graph.h"
+#include "../src/graph/closure_table.h"
+#include "../src/graph/graph.h"
 
 // Test class
 /**
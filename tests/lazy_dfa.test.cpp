@@ -0,0 +1,74 @@
+/**
+ * @file lazy_dfa.test.cpp
+ * @author Carlos Salguero
+ * @brief Implementation of LazyDfaTest class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+// C++ Standard Library
+#include <string>
+
+// Project file
+#include "lazy_dfa.test.h"
+
+// Methods
+/**
+ * @brief
+ * Set up the test fixture with an expression whose DFA is exponential
+ */
+void LazyDfaTest::SetUp()
+{
+    Automata automata("(a|b)*a(a|b)(a|b)(a|b)(a|b)");
+
+    nfa = automata.build();
+    matcher = std::make_unique<Matcher>(*automata.transform_dfa());
+}
+
+// Tests
+// Test match() and find() agree with the full DFA
+TEST_F(LazyDfaTest, AgreesWithDfa)
+{
+    LazyDfa lazy(nfa);
+    const std::string inputs[] = {"", "a", "abbbb", "bbbbb", "aaaaaaa",
+                                  "babbab", "xxabbbbxx", "bbbbbbbbab"};
+
+    for (const std::string &input : inputs)
+    {
+        EXPECT_EQ(lazy.match(input), matcher->match(input)) << input;
+        EXPECT_EQ(lazy.find(input), matcher->find(input)) << input;
+    }
+}
+
+// Test the cache is reused across calls
+TEST_F(LazyDfaTest, CacheHits)
+{
+    LazyDfa lazy(nfa);
+
+    lazy.match("abababab");
+    EXPECT_GT(lazy.get_stats().misses, 0);
+
+    lazy.reset_stats();
+    lazy.match("abababab");
+    EXPECT_EQ(lazy.get_stats().misses, 0);
+    EXPECT_EQ(lazy.get_stats().hits, 8);
+    EXPECT_EQ(lazy.get_stats().flushes, 0);
+}
+
+// Test a small budget flushes the cache and still matches correctly
+TEST_F(LazyDfaTest, FlushOnBudget)
+{
+    LazyDfa lazy(nfa, 4);
+    std::string input;
+
+    for (int i = 0; i < 200; i++)
+        input += (i * 7 % 3 == 0) ? 'a' : 'b';
+
+    EXPECT_EQ(lazy.match(input), matcher->match(input));
+    EXPECT_EQ(lazy.find(input), matcher->find(input));
+    EXPECT_GT(lazy.get_stats().flushes, 0);
+    EXPECT_LE(lazy.get_cached_state_count(), 4);
+}
@@ -0,0 +1,42 @@
+/**
+ * @file lazy_dfa.test.h
+ * @author Carlos Salguero
+ * @brief Tests for LazyDfa class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef LAZY_DFA_TEST_H
+#define LAZY_DFA_TEST_H
+
+// C++ Standard Library
+#include <memory>
+
+// Google Test
+#include <gtest/gtest.h>
+
+// Project files
+#include "../src/automata/automata.h"
+#include "../src/matcher/lazy_dfa.h"
+#include "../src/matcher/matcher.h"
+
+// Test class
+/**
+ * @class LazyDfaTest
+ * @brief Tests for LazyDfa class
+ * @extends ::testing::Test
+ */
+class LazyDfaTest : public ::testing::Test
+{
+protected:
+    std::shared_ptr<Graph> nfa;
+    std::unique_ptr<Matcher> matcher;
+
+    // Methods
+    void SetUp() override;
+};
+
+#endif //! LAZY_DFA_TEST_H
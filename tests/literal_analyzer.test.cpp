@@ -0,0 +1,78 @@
+/**
+ * @file literal_analyzer.test.cpp
+ * @author Carlos Salguero
+ * @brief Implementation of LiteralAnalyzerTest class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+// C++ Standard Library
+#include <vector>
+
+// Project file
+#include "literal_analyzer.test.h"
+
+// Methods
+/**
+ * @brief
+ * Analyzes the Thompson NFA of an expression
+ * @param expression Regular expression
+ * @return LiteralAnalyzer literals of the expression
+ */
+LiteralAnalyzer LiteralAnalyzerTest::analyze(const std::string &expression) const
+{
+    Automata automata(expression);
+    return LiteralAnalyzer(*automata.build());
+}
+
+// Tests
+// Test a plain literal is its own prefix, suffix and factor
+TEST_F(LiteralAnalyzerTest, Literal)
+{
+    LiteralAnalyzer literals = analyze("abc");
+
+    EXPECT_EQ(literals.get_prefix(), "abc");
+    EXPECT_EQ(literals.get_suffix(), "abc");
+    EXPECT_EQ(literals.get_required(), "abc");
+}
+
+// Test a literal after a star is a suffix but not a prefix
+TEST_F(LiteralAnalyzerTest, Suffix)
+{
+    LiteralAnalyzer literals = analyze("(a|b)*abb");
+
+    EXPECT_EQ(literals.get_prefix(), "");
+    EXPECT_EQ(literals.get_suffix(), "abb");
+    EXPECT_EQ(literals.get_required(), "abb");
+}
+
+// Test the factors around an optional part are kept in match order
+TEST_F(LiteralAnalyzerTest, Factors)
+{
+    LiteralAnalyzer literals = analyze("ab(c|d)*wxyz");
+
+    EXPECT_EQ(literals.get_prefix(), "ab");
+    EXPECT_EQ(literals.get_suffix(), "wxyz");
+    EXPECT_EQ(literals.get_required(), "wxyz");
+    EXPECT_EQ(literals.get_factors(), (std::vector<std::string>{"ab", "wxyz"}));
+}
+
+// Test a literal inside a plus is still required once
+TEST_F(LiteralAnalyzerTest, Plus)
+{
+    LiteralAnalyzer literals = analyze("x(abc)+");
+
+    EXPECT_EQ(literals.get_prefix(), "xabc");
+    EXPECT_EQ(literals.get_suffix(), "");
+}
+
+// Test alternatives and stars leave nothing required
+TEST_F(LiteralAnalyzerTest, Nothing)
+{
+    EXPECT_EQ(analyze("ab|cd").get_required(), "");
+    EXPECT_EQ(analyze("(abc)*").get_required(), "");
+    EXPECT_TRUE(analyze("a*b*").get_factors().empty());
+}
@@ -0,0 +1,38 @@
+/**
+ * @file literal_analyzer.test.h
+ * @author Carlos Salguero
+ * @brief Tests for LiteralAnalyzer class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef LITERAL_ANALYZER_TEST_H
+#define LITERAL_ANALYZER_TEST_H
+
+// C++ Standard Library
+#include <string>
+
+// Google Test
+#include <gtest/gtest.h>
+
+// Project files
+#include "../src/automata/automata.h"
+#include "../src/automata/literal_analyzer.h"
+
+// Test class
+/**
+ * @class LiteralAnalyzerTest
+ * @brief Tests for LiteralAnalyzer class
+ * @extends ::testing::Test
+ */
+class LiteralAnalyzerTest : public ::testing::Test
+{
+protected:
+    // Methods
+    LiteralAnalyzer analyze(const std::string &) const;
+};
+
+#endif //! LITERAL_ANALYZER_TEST_H
@@ -0,0 +1,93 @@
+/**
+ * @file mapped_file.test.cpp
+ * @author Carlos Salguero
+ * @brief Implementation of MappedFileTest class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+// C++ Standard Library
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <system_error>
+#include <utility>
+
+// POSIX
+#include <unistd.h>
+
+// Project file
+#include "mapped_file.test.h"
+
+// Methods
+/**
+ * @brief
+ * Set up the test fixture with a path in the temporary directory
+ */
+void MappedFileTest::SetUp()
+{
+    path = (std::filesystem::temp_directory_path() /
+            ("mapped_file_test_" + std::to_string(::getpid())))
+               .string();
+}
+
+/**
+ * @brief
+ * Removes the file written by the test
+ */
+void MappedFileTest::TearDown()
+{
+    std::remove(path.c_str());
+}
+
+/**
+ * @brief
+ * Writes the file to be mapped
+ * @param contents Contents of the file
+ */
+void MappedFileTest::write(const std::string &contents) const
+{
+    std::ofstream file(path, std::ios::binary);
+    file << contents;
+}
+
+// Tests
+// Test the mapping holds the contents of the file
+TEST_F(MappedFileTest, Contents)
+{
+    write("abb\nxyz\n");
+    MappedFile file(path);
+
+    EXPECT_EQ(file.get_data(), "abb\nxyz\n");
+    EXPECT_EQ(file.get_size(), 8);
+    EXPECT_EQ(file.get_path(), path);
+}
+
+// Test an empty file maps to empty data
+TEST_F(MappedFileTest, Empty)
+{
+    write("");
+    MappedFile file(path);
+
+    EXPECT_TRUE(file.get_data().empty());
+}
+
+// Test a missing file throws
+TEST_F(MappedFileTest, Missing)
+{
+    EXPECT_THROW(MappedFile(path + ".missing"), std::system_error);
+}
+
+// Test moving keeps a single owner of the mapping
+TEST_F(MappedFileTest, Move)
+{
+    write("abc");
+    MappedFile file(path);
+    MappedFile moved(std::move(file));
+
+    EXPECT_EQ(moved.get_data(), "abc");
+    EXPECT_TRUE(file.get_data().empty());
+}
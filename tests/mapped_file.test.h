@@ -0,0 +1,41 @@
+/**
+ * @file mapped_file.test.h
+ * @author Carlos Salguero
+ * @brief Tests for MappedFile class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef MAPPED_FILE_TEST_H
+#define MAPPED_FILE_TEST_H
+
+// C++ Standard Library
+#include <string>
+
+// Google Test
+#include <gtest/gtest.h>
+
+// Project files
+#include "../src/io/mapped_file.h"
+
+// Test class
+/**
+ * @class MappedFileTest
+ * @brief Tests for MappedFile class
+ * @extends ::testing::Test
+ */
+class MappedFileTest : public ::testing::Test
+{
+protected:
+    std::string path;
+
+    // Methods
+    void SetUp() override;
+    void TearDown() override;
+    void write(const std::string &) const;
+};
+
+#endif //! MAPPED_FILE_TEST_H
@@ -0,0 +1,178 @@
+/**
+ * @file matcher.test.cpp
+ * @author Carlos Salguero
+ * @brief Implementation of MatcherTest class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+// C++ Standard Library
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Project files
+#include "matcher.test.h"
+#include "../src/matcher/matcher_file.h"
+
+// Methods
+/**
+ * @brief
+ * Set up the test fixture
+ */
+void MatcherTest::SetUp()
+{
+    Automata automata("(a|b)*abb");
+    matcher = std::make_unique<Matcher>(*automata.transform_dfa());
+}
+
+// Tests
+// Test match() on whole inputs
+TEST_F(MatcherTest, Match)
+{
+    EXPECT_TRUE(matcher->match("abb"));
+    EXPECT_TRUE(matcher->match("bbaabb"));
+    EXPECT_FALSE(matcher->match(""));
+    EXPECT_FALSE(matcher->match("abba"));
+    EXPECT_FALSE(matcher->match("xabb"));
+}
+
+// Test match() on inputs longer than one unrolled block
+TEST_F(MatcherTest, MatchLongInput)
+{
+    std::string input(1000, 'a');
+    EXPECT_FALSE(matcher->match(input));
+
+    input += "bb";
+    EXPECT_TRUE(matcher->match(input));
+
+    input[10] = 'z';
+    EXPECT_FALSE(matcher->match(input));
+}
+
+// Test find() returns the end of the earliest ending match
+TEST_F(MatcherTest, Find)
+{
+    EXPECT_EQ(matcher->find("xxabbxx"), 5);
+    EXPECT_EQ(matcher->find("zzzabbabb"), 6);
+    EXPECT_FALSE(matcher->find("ab ba").has_value());
+}
+
+// Test find() on a nullable expression matches at offset 0
+TEST_F(MatcherTest, FindNullable)
+{
+    Automata automata("a*");
+    Matcher nullable(*automata.transform_dfa());
+
+    EXPECT_EQ(nullable.find("bbb"), 0);
+    EXPECT_TRUE(nullable.match("aaa"));
+}
+
+// Test state counts include the dead state
+TEST_F(MatcherTest, StateCount)
+{
+    EXPECT_EQ(matcher->get_state_count(), 6);
+    EXPECT_GE(matcher->get_search_state_count(), 2);
+}
+
+// Test the unanchored table is bounded even when the anchored one is small
+TEST_F(MatcherTest, SearchStateBudget)
+{
+    Automata automata("a[ab]{20}");
+    std::shared_ptr<Graph> dfa = automata.transform_dfa();
+
+    EXPECT_THROW(Matcher{*dfa}, std::length_error);
+    EXPECT_THROW(Matcher(*dfa, 1000), std::length_error);
+    EXPECT_TRUE(Matcher(*Automata("a[ab]{4}").transform_dfa(), 1000)
+                    .find("bbababb"));
+}
+
+// Test rows are indexed by byte class: {a}, {b} and every other byte
+TEST_F(MatcherTest, ClassCount)
+{
+    EXPECT_EQ(matcher->get_class_count(), 3);
+    EXPECT_LT(matcher->get_memory_usage(),
+              matcher->get_state_count() * 256 * sizeof(std::uint32_t));
+}
+
+// Test a saved matcher loads as a mapping and matches the same inputs
+TEST_F(MatcherTest, SaveLoad)
+{
+    std::string path =
+        (std::filesystem::temp_directory_path() / "matcher_test.dfa").string();
+
+    matcher->save(path);
+    Matcher loaded = Matcher::load(path);
+
+    EXPECT_TRUE(loaded.is_mapped());
+    EXPECT_FALSE(matcher->is_mapped());
+    EXPECT_EQ(loaded.get_state_count(), matcher->get_state_count());
+    EXPECT_EQ(loaded.get_class_count(), matcher->get_class_count());
+    EXPECT_TRUE(loaded.match("bbaabb"));
+    EXPECT_FALSE(loaded.match("abba"));
+    EXPECT_EQ(loaded.find("xxabbxx"), 5);
+
+    std::remove(path.c_str());
+}
+
+// Test loading rejects files that are not a valid image
+TEST_F(MatcherTest, LoadInvalid)
+{
+    std::string path =
+        (std::filesystem::temp_directory_path() / "matcher_test.dfa").string();
+    std::span<const std::byte> image = matcher->get_image();
+
+    {
+        std::ofstream file(path, std::ios::binary);
+        file.write(reinterpret_cast<const char *>(image.data()),
+                   image.size() - 8);
+    }
+
+    EXPECT_THROW(Matcher::load(path), std::runtime_error);
+
+    {
+        std::ofstream file(path, std::ios::binary);
+        file << "not a matcher";
+    }
+
+    EXPECT_THROW(Matcher::load(path), std::runtime_error);
+
+    std::vector<std::byte> corrupted(image.begin(), image.end());
+    const MatcherFileHeader &header =
+        *reinterpret_cast<const MatcherFileHeader *>(corrupted.data());
+    std::uint32_t entry = 1u << 30;
+
+    std::memcpy(corrupted.data() + header.sections[SECTION_TABLE].offset,
+                &entry, sizeof(entry));
+
+    {
+        std::ofstream file(path, std::ios::binary);
+        file.write(reinterpret_cast<const char *>(corrupted.data()),
+                   corrupted.size());
+    }
+
+    EXPECT_THROW(Matcher::load(path), std::runtime_error);
+
+    std::remove(path.c_str());
+}
+
+// Test a failed save leaves no temporary file behind
+TEST_F(MatcherTest, SaveFailureRemovesTemporary)
+{
+    std::filesystem::path directory =
+        std::filesystem::temp_directory_path() / "matcher_test_directory";
+
+    std::filesystem::create_directories(directory / "occupied");
+
+    EXPECT_ANY_THROW(matcher->save(directory.string()));
+    EXPECT_FALSE(std::filesystem::exists(directory.string() + ".tmp"));
+
+    std::filesystem::remove_all(directory);
+}
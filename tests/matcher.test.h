@@ -0,0 +1,40 @@
+/**
+ * @file matcher.test.h
+ * @author Carlos Salguero
+ * @brief Tests for Matcher class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef MATCHER_TEST_H
+#define MATCHER_TEST_H
+
+// C++ Standard Library
+#include <memory>
+
+// Google Test
+#include <gtest/gtest.h>
+
+// Project files
+#include "../src/automata/automata.h"
+#include "../src/matcher/matcher.h"
+
+// Test class
+/**
+ * @class MatcherTest
+ * @brief Tests for Matcher class
+ * @extends ::testing::Test
+ */
+class MatcherTest : public ::testing::Test
+{
+protected:
+    std::unique_ptr<Matcher> matcher;
+
+    // Methods
+    void SetUp() override;
+};
+
+#endif //! MATCHER_TEST_H
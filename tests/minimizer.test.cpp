@@ -0,0 +1,64 @@
+/**
+ * @file minimizer.test.cpp
+ * @author Carlos Salguero
+ * @brief Implementation of MinimizerTest class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+// Project file
+#include "minimizer.test.h"
+
+// Methods
+/**
+ * @brief
+ * Minimizes the DFA of an expression
+ * @param expression Regular expression
+ * @return std::shared_ptr<Graph> minimal DFA
+ */
+std::shared_ptr<Graph> MinimizerTest::minimize(const std::string &expression)
+{
+    Automata automata(expression);
+    return minimizer.minimize(*automata.transform_dfa());
+}
+
+// Tests
+// Test minimize() on the textbook example
+TEST_F(MinimizerTest, MinimizeTextbook)
+{
+    std::shared_ptr<Graph> dfa = minimize("(a|b)*abb");
+    Matcher matcher(*dfa);
+
+    EXPECT_EQ(dfa->get_next(), 4);
+    EXPECT_EQ(minimizer.get_stats().states_before, 5);
+    EXPECT_EQ(minimizer.get_stats().states_after, 4);
+    EXPECT_EQ(minimizer.get_stats().states_removed, 1);
+
+    EXPECT_TRUE(matcher.match("ababb"));
+    EXPECT_FALSE(matcher.match("abab"));
+}
+
+// Test minimize() merges redundant alternatives
+TEST_F(MinimizerTest, MinimizeRedundantUnion)
+{
+    std::shared_ptr<Graph> dfa = minimize("(a*)|(a*)");
+    Matcher matcher(*dfa);
+
+    EXPECT_EQ(dfa->get_next(), 1);
+    EXPECT_TRUE(dfa->is_final(dfa->get_start()));
+    EXPECT_TRUE(matcher.match(""));
+    EXPECT_TRUE(matcher.match("aaaa"));
+    EXPECT_FALSE(matcher.match("ab"));
+}
+
+// Test minimize() keeps distinct states apart
+TEST_F(MinimizerTest, MinimizeKeepsDistinctStates)
+{
+    std::shared_ptr<Graph> dfa = minimize("ab+");
+
+    EXPECT_EQ(dfa->get_next(), 3);
+    EXPECT_EQ(minimizer.get_stats().states_unreachable, 0);
+}
@@ -0,0 +1,42 @@
+/**
+ * @file minimizer.test.h
+ * @author Carlos Salguero
+ * @brief Tests for Minimizer class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef MINIMIZER_TEST_H
+#define MINIMIZER_TEST_H
+
+// C++ Standard Library
+#include <memory>
+#include <string>
+
+// Google Test
+#include <gtest/gtest.h>
+
+// Project files
+#include "../src/automata/automata.h"
+#include "../src/automata/minimizer.h"
+#include "../src/matcher/matcher.h"
+
+// Test class
+/**
+ * @class MinimizerTest
+ * @brief Tests for Minimizer class
+ * @extends ::testing::Test
+ */
+class MinimizerTest : public ::testing::Test
+{
+protected:
+    Minimizer minimizer;
+
+    // Methods
+    std::shared_ptr<Graph> minimize(const std::string &);
+};
+
+#endif //! MINIMIZER_TEST_H
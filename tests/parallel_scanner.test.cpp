@@ -0,0 +1,113 @@
+/**
+ * @file parallel_scanner.test.cpp
+ * @author Carlos Salguero
+ * @brief Implementation of ParallelScannerTest class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+// C++ Standard Library
+#include <cstdint>
+
+// Project file
+#include "parallel_scanner.test.h"
+
+// Methods
+/**
+ * @brief
+ * Set up the test fixture with a pseudo-random input over {a, b, c}
+ */
+void ParallelScannerTest::SetUp()
+{
+    std::uint32_t seed = 12345;
+    input.resize(50000);
+
+    for (char &character : input)
+    {
+        seed = seed * 1103515245 + 12345;
+        character = "aabbc"[(seed >> 16) % 5];
+    }
+}
+
+/**
+ * @brief
+ * Compiles an expression into a shared matcher
+ * @param expression Regular expression
+ * @return std::shared_ptr<const Matcher> matcher
+ */
+std::shared_ptr<const Matcher> ParallelScannerTest::compile(
+    const std::string &expression) const
+{
+    Automata automata(expression);
+    return std::make_shared<const Matcher>(*automata.transform_dfa());
+}
+
+/**
+ * @brief
+ * Finds every match end with a single sequential run
+ * @param matcher Compiled expression
+ * @return std::vector<std::size_t> end offsets
+ */
+std::vector<std::size_t> ParallelScannerTest::expected(
+    const Matcher &matcher) const
+{
+    std::vector<std::size_t> ends;
+    std::uint32_t state = matcher.get_search_start();
+
+    for (std::size_t i = 0; i < input.size(); i++)
+    {
+        state = matcher.search_step(state, input[i]);
+
+        if (matcher.is_search_accepting(state))
+            ends.push_back(i + 1);
+    }
+
+    return ends;
+}
+
+// Tests
+// Test AUTO picks enumeration for small tables only
+TEST_F(ParallelScannerTest, AutoStrategy)
+{
+    ParallelScanner small(compile("ab*c"), 4);
+    ParallelScanner large(compile("(a|b)*a(a|b)(a|b)(a|b)(a|b)(a|b)"), 4);
+
+    EXPECT_EQ(small.get_strategy(), ParallelStrategy::ENUMERATE);
+    EXPECT_EQ(large.get_strategy(), ParallelStrategy::SPECULATE);
+}
+
+// Test both strategies agree with a sequential run, across chunk sizes
+// below and above one checkpoint
+TEST_F(ParallelScannerTest, AgreesWithSequential)
+{
+    for (const std::string expression :
+         {"ab*c", "(a|b)*a(a|b)(a|b)(a|b)(a|b)(a|b)", "c(a|b)*c"})
+    {
+        std::shared_ptr<const Matcher> matcher = compile(expression);
+        std::vector<std::size_t> ends = expected(*matcher);
+
+        for (ParallelStrategy strategy :
+             {ParallelStrategy::ENUMERATE, ParallelStrategy::SPECULATE})
+            for (unsigned threads : {2u, 7u, 16u})
+            {
+                ParallelScanner scanner(matcher, threads, strategy, 1000);
+
+                EXPECT_EQ(scanner.scan(input), ends)
+                    << expression << " with " << threads << " threads";
+                EXPECT_EQ(scanner.count(input), ends.size())
+                    << expression << " with " << threads << " threads";
+            }
+    }
+}
+
+// Test inputs smaller than a chunk are scanned on one thread
+TEST_F(ParallelScannerTest, SmallInput)
+{
+    ParallelScanner scanner(compile("ab*c"), 8);
+
+    EXPECT_EQ(scanner.scan("xabbcac"), std::vector<std::size_t>({5, 7}));
+    EXPECT_EQ(scanner.count(""), 0);
+}
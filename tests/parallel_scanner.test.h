@@ -0,0 +1,45 @@
+/**
+ * @file parallel_scanner.test.h
+ * @author Carlos Salguero
+ * @brief Tests for ParallelScanner class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef PARALLEL_SCANNER_TEST_H
+#define PARALLEL_SCANNER_TEST_H
+
+// C++ Standard Library
+#include <memory>
+#include <string>
+#include <vector>
+
+// Google Test
+#include <gtest/gtest.h>
+
+// Project files
+#include "../src/automata/automata.h"
+#include "../src/matcher/matcher.h"
+#include "../src/matcher/parallel_scanner.h"
+
+// Test class
+/**
+ * @class ParallelScannerTest
+ * @brief Tests for ParallelScanner class
+ * @extends ::testing::Test
+ */
+class ParallelScannerTest : public ::testing::Test
+{
+protected:
+    std::string input;
+
+    // Methods
+    void SetUp() override;
+    std::shared_ptr<const Matcher> compile(const std::string &) const;
+    std::vector<std::size_t> expected(const Matcher &) const;
+};
+
+#endif //! PARALLEL_SCANNER_TEST_H
@@ -0,0 +1,141 @@
+/**
+ * @file parser.test.cpp
+ * @author Carlos Salguero
+ * @brief Implementation of ParserTest class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+// C++ Standard Library
+#include <stdexcept>
+
+// Project file
+#include "parser.test.h"
+
+// The parser runs in constant evaluation as well
+static_assert(Parser("(a|b)*abb").parse().size() == 8);
+
+// Methods
+/**
+ * @brief
+ * Parses an expression and spells its tree back
+ * @param expression Regular expression
+ * @return std::string expression with the parentheses precedence needs
+ */
+std::string ParserTest::parse(const std::string &expression) const
+{
+    return Parser(expression).parse().to_string();
+}
+
+// Tests
+// Test concatenation binds tighter than alternation
+TEST_F(ParserTest, Precedence)
+{
+    Ast ast = Parser("ab|c").parse();
+    const Node &root = ast.get_node(ast.get_root());
+
+    ASSERT_EQ(root.type, NodeType::ALTERNATE);
+    ASSERT_EQ(root.children.size(), 2u);
+    EXPECT_EQ(ast.get_node(root.children[0]).type, NodeType::CONCAT);
+    EXPECT_EQ(ast.get_node(root.children[1]).type, NodeType::LITERAL);
+}
+
+// Test repetition binds tighter than concatenation
+TEST_F(ParserTest, Repetition)
+{
+    EXPECT_EQ(parse("ab*"), "ab*");
+    EXPECT_EQ(parse("(ab)*"), "(ab)*");
+    EXPECT_EQ(parse("a*+"), "a*+");
+    EXPECT_EQ(parse("(a|b)+c"), "(a|b)+c");
+}
+
+// Test optional and counted repetitions
+TEST_F(ParserTest, CountedRepetition)
+{
+    EXPECT_EQ(parse("ab?"), "ab?");
+    EXPECT_EQ(parse("a{3}"), "a{3}");
+    EXPECT_EQ(parse("(ab){2,}"), "(ab){2,}");
+    EXPECT_EQ(parse("[0-9]{1,1000}"), "[0-9]{1,1000}");
+    EXPECT_EQ(parse("a{0,1}"), "a?");
+    EXPECT_EQ(parse("a{2}*"), "a{2}*");
+}
+
+// Test the empty string
+TEST_F(ParserTest, Epsilon)
+{
+    EXPECT_EQ(parse(""), "");
+    EXPECT_EQ(parse("()"), "");
+    EXPECT_EQ(parse("a|"), "a|");
+    EXPECT_EQ(parse("()*b"), "()*b");
+}
+
+// Test an uppercase E is a literal like any other letter
+TEST_F(ParserTest, LiteralE)
+{
+    Ast ast = Parser("E").parse();
+
+    EXPECT_EQ(ast.get_node(ast.get_root()).type, NodeType::LITERAL);
+    EXPECT_EQ(parse("ERROR|GET"), "ERROR|GET");
+    EXPECT_EQ(parse("[E]+"), "E+");
+}
+
+// Test escaped special characters are literals
+TEST_F(ParserTest, Escapes)
+{
+    Ast ast = Parser("\\*").parse();
+
+    EXPECT_EQ(ast.get_node(ast.get_root()).type, NodeType::LITERAL);
+    EXPECT_EQ(ast.get_node(ast.get_root()).symbol, '*');
+    EXPECT_EQ(parse("\\(\\|\\)"), "\\(\\|\\)");
+}
+
+// Test bracket expressions, the dot and class escapes
+TEST_F(ParserTest, Classes)
+{
+    EXPECT_EQ(parse("[a-z0-9_]"), "[0-9_a-z]");
+    EXPECT_EQ(parse("[^\\n]"), ".");
+    EXPECT_EQ(parse("[]a]"), "[\\]a]");
+    EXPECT_EQ(parse("[a-]"), "[\\-a]");
+    EXPECT_EQ(parse("\\d+"), "[0-9]+");
+    EXPECT_EQ(parse("[\\w-]"), "[\\-0-9A-Z_a-z]");
+    EXPECT_EQ(parse("[b]"), "b");
+    EXPECT_EQ(parse("\\x41\\t\\E"), "A\\tE");
+    EXPECT_EQ(parse("[^\\x00-\\xff]"), "[^\\x00-\\xff]");
+}
+
+// Test malformed expressions are rejected
+TEST_F(ParserTest, Malformed)
+{
+    EXPECT_THROW(parse("(ab"), std::invalid_argument);
+    EXPECT_THROW(parse("ab)"), std::invalid_argument);
+    EXPECT_THROW(parse("*a"), std::invalid_argument);
+    EXPECT_THROW(parse("a|+"), std::invalid_argument);
+    EXPECT_THROW(parse("a\\"), std::invalid_argument);
+    EXPECT_THROW(parse("[ab"), std::invalid_argument);
+    EXPECT_THROW(parse("[z-a]"), std::invalid_argument);
+    EXPECT_THROW(parse("[\\d-z]"), std::invalid_argument);
+    EXPECT_THROW(parse("?a"), std::invalid_argument);
+    EXPECT_THROW(parse("a{"), std::invalid_argument);
+    EXPECT_THROW(parse("a{,2}"), std::invalid_argument);
+    EXPECT_THROW(parse("a{2"), std::invalid_argument);
+    EXPECT_THROW(parse("a{3,2}"), std::invalid_argument);
+    EXPECT_THROW(parse("a{1001}"), std::invalid_argument);
+    EXPECT_THROW(parse("(a{1000}){1000}"), std::invalid_argument);
+    EXPECT_THROW(parse("((ab){100}c){1000}"), std::invalid_argument);
+    EXPECT_NO_THROW(parse("(a{100}){100}"));
+}
+
+// Test groups and repetitions nested past the limit are rejected
+TEST_F(ParserTest, NestingDepth)
+{
+    const std::string deep = std::string(100000, '(') + "a" +
+                             std::string(100000, ')');
+
+    EXPECT_THROW(parse(deep), std::invalid_argument);
+    EXPECT_THROW(parse("a" + std::string(100000, '*')), std::invalid_argument);
+    EXPECT_EQ(parse(std::string(1000, '(') + "a" + std::string(1000, ')')),
+              "a");
+}
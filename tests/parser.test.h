@@ -0,0 +1,37 @@
+/**
+ * @file parser.test.h
+ * @author Carlos Salguero
+ * @brief Tests for Parser class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef PARSER_TEST_H
+#define PARSER_TEST_H
+
+// C++ Standard Library
+#include <string>
+
+// Google Test
+#include <gtest/gtest.h>
+
+// Project files
+#include "../src/parser/parser.h"
+
+// Test class
+/**
+ * @class ParserTest
+ * @brief Tests for Parser class
+ * @extends ::testing::Test
+ */
+class ParserTest : public ::testing::Test
+{
+protected:
+    // Methods
+    std::string parse(const std::string &) const;
+};
+
+#endif //! PARSER_TEST_H
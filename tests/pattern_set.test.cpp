@@ -0,0 +1,156 @@
+/**
+ * @file pattern_set.test.cpp
+ * @author Carlos Salguero
+ * @brief Implementation of PatternSetTest class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+// C++ Standard Library
+#include <stdexcept>
+#include <vector>
+
+// Project file
+#include "pattern_set.test.h"
+
+// Methods
+/**
+ * @brief
+ * Set up the test fixture with overlapping patterns
+ */
+void PatternSetTest::SetUp()
+{
+    patterns.add("abc");
+    patterns.add("a(b|c)*");
+    patterns.add("xy");
+    patterns.compile();
+}
+
+// Tests
+// Test add() returns consecutive ids
+TEST_F(PatternSetTest, Add)
+{
+    EXPECT_EQ(patterns.size(), 3);
+    EXPECT_EQ(patterns.add("z"), 3);
+    EXPECT_FALSE(patterns.is_compiled());
+}
+
+// Test match() reports every pattern matching the whole input
+TEST_F(PatternSetTest, Match)
+{
+    EXPECT_EQ(patterns.match("abc"), std::vector<int>({0, 1}));
+    EXPECT_EQ(patterns.match("abb"), std::vector<int>({1}));
+    EXPECT_EQ(patterns.match("xy"), std::vector<int>({2}));
+    EXPECT_TRUE(patterns.match("abx").empty());
+}
+
+// Test scan() reports every pattern matching anywhere in one pass
+TEST_F(PatternSetTest, Scan)
+{
+    EXPECT_EQ(patterns.scan("zzabczz"), std::vector<int>({0, 1}));
+    EXPECT_EQ(patterns.scan("xya"), std::vector<int>({1, 2}));
+    EXPECT_TRUE(patterns.scan("zzz").empty());
+}
+
+// Test minimization keeps states of different patterns apart
+TEST_F(PatternSetTest, MinimizedDfaKeepsIds)
+{
+    PatternSet same;
+    same.add("ab");
+    same.add("ab");
+    same.add("ac");
+    same.compile();
+
+    EXPECT_EQ(same.match("ab"), std::vector<int>({0, 1}));
+    EXPECT_EQ(same.match("ac"), std::vector<int>({2}));
+    EXPECT_EQ(same.get_dfa()->get_final().size(), 2);
+}
+
+// Test matching before compile() throws
+TEST_F(PatternSetTest, NotCompiled)
+{
+    patterns.add("z");
+    EXPECT_THROW(patterns.match("z"), std::logic_error);
+}
+
+// Test remove() drops a pattern from the results without compiling again
+TEST_F(PatternSetTest, Remove)
+{
+    patterns.remove(0);
+
+    EXPECT_TRUE(patterns.is_compiled());
+    EXPECT_TRUE(patterns.is_removed(0));
+    EXPECT_EQ(patterns.match("abc"), std::vector<int>({1}));
+    EXPECT_EQ(patterns.scan("zzabczz"), std::vector<int>({1}));
+    EXPECT_THROW(patterns.remove(0), std::out_of_range);
+    EXPECT_THROW(patterns.remove(3), std::out_of_range);
+}
+
+// Test patterns added after a rebuild are compiled into the delta level
+TEST_F(PatternSetTest, IncrementalAdd)
+{
+    EXPECT_EQ(patterns.add("ab+c"), 3);
+    patterns.compile();
+
+    EXPECT_EQ(patterns.get_delta_count(), 1);
+    EXPECT_EQ(patterns.match("abc"), std::vector<int>({0, 1, 3}));
+    EXPECT_EQ(patterns.scan("xyabbc"), std::vector<int>({1, 2, 3}));
+
+    patterns.remove(3);
+    patterns.compile();
+
+    EXPECT_EQ(patterns.get_delta_count(), 0);
+    EXPECT_EQ(patterns.match("abc"), std::vector<int>({0, 1}));
+}
+
+// Test a large delta or many tombstones trigger a full rebuild
+TEST_F(PatternSetTest, Rebuild)
+{
+    for (std::size_t i = 0; i <= PATTERN_SET_MAX_DELTA; i++)
+        patterns.add("q" + std::to_string(i));
+
+    patterns.compile();
+
+    EXPECT_EQ(patterns.get_delta_count(), 0);
+    EXPECT_EQ(patterns.match("q32"), std::vector<int>({35}));
+
+    for (int id = 3; id <= 20; id++)
+        patterns.remove(id);
+
+    patterns.add("xy");
+    patterns.compile();
+
+    EXPECT_EQ(patterns.get_delta_count(), 1);
+
+    patterns.remove(21);
+    patterns.compile();
+
+    EXPECT_EQ(patterns.get_delta_count(), 0);
+    EXPECT_EQ(patterns.match("xy"), std::vector<int>({2, 36}));
+    EXPECT_TRUE(patterns.match("q18").empty());
+}
+
+// Test a pattern whose DFA exceeds the state budget is rejected on compile
+TEST_F(PatternSetTest, StateBudget)
+{
+    int id = patterns.add("(a|b)*a(a|b){20}");
+
+    EXPECT_THROW(patterns.compile(), std::length_error);
+    EXPECT_THROW(patterns.rebuild(), std::length_error);
+
+    patterns.remove(id);
+    patterns.compile();
+
+    EXPECT_EQ(patterns.match("abc"), std::vector<int>({0, 1}));
+}
+
+// Test a malformed pattern is rejected by add()
+TEST_F(PatternSetTest, Malformed)
+{
+    EXPECT_THROW(patterns.add("a(b"), std::invalid_argument);
+    EXPECT_EQ(patterns.size(), 3);
+    EXPECT_TRUE(patterns.is_compiled());
+}
@@ -0,0 +1,36 @@
+/**
+ * @file pattern_set.test.h
+ * @author Carlos Salguero
+ * @brief Tests for PatternSet class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef PATTERN_SET_TEST_H
+#define PATTERN_SET_TEST_H
+
+// Google Test
+#include <gtest/gtest.h>
+
+// Project files
+#include "../src/regex/pattern_set.h"
+
+// Test class
+/**
+ * @class PatternSetTest
+ * @brief Tests for PatternSet class
+ * @extends ::testing::Test
+ */
+class PatternSetTest : public ::testing::Test
+{
+protected:
+    PatternSet patterns;
+
+    // Methods
+    void SetUp() override;
+};
+
+#endif //! PATTERN_SET_TEST_H
@@ -0,0 +1,82 @@
+/**
+ * @file prefilter.test.cpp
+ * @author Carlos Salguero
+ * @brief Implementation of PrefilterTest class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+// C++ Standard Library
+#include <string_view>
+
+// Project file
+#include "prefilter.test.h"
+
+// Methods
+/**
+ * @brief
+ * Set up the test fixture with an input longer than a few vectors, full of
+ * near misses
+ */
+void PrefilterTest::SetUp()
+{
+    haystack.clear();
+
+    for (int i = 0; i < 20; i++)
+        haystack += "needlx nxxxle ";
+}
+
+// Tests
+// Test the empty literal matches at every offset
+TEST_F(PrefilterTest, Empty)
+{
+    Prefilter prefilter("");
+
+    EXPECT_TRUE(prefilter.is_empty());
+    EXPECT_EQ(prefilter.find(haystack, 7), 7u);
+    EXPECT_EQ(prefilter.find(haystack, haystack.size() + 1),
+              std::string_view::npos);
+}
+
+// Test a single byte literal
+TEST_F(PrefilterTest, SingleByte)
+{
+    Prefilter prefilter("x");
+
+    EXPECT_EQ(prefilter.find(haystack), 5u);
+    EXPECT_EQ(prefilter.find(haystack, 6), 8u);
+    EXPECT_EQ(Prefilter("q").find(haystack), std::string_view::npos);
+}
+
+// Test near misses sharing the first and last byte are rejected
+TEST_F(PrefilterTest, NearMisses)
+{
+    Prefilter prefilter("needle");
+
+    EXPECT_EQ(prefilter.find(haystack), std::string_view::npos);
+
+    haystack += "needle";
+    EXPECT_EQ(prefilter.find(haystack), haystack.size() - 6);
+}
+
+// Test every offset in and around a vector is found
+TEST_F(PrefilterTest, EveryOffset)
+{
+    Prefilter prefilter("abc");
+
+    for (std::size_t offset = 0; offset < 80; offset++)
+    {
+        std::string input(100, '.');
+        input.replace(offset, 3, "abc");
+
+        EXPECT_EQ(prefilter.find(input), offset);
+        EXPECT_EQ(prefilter.find(input, offset), offset);
+        EXPECT_EQ(prefilter.find(input, offset + 1), std::string_view::npos);
+        EXPECT_EQ(prefilter.find(std::string_view(input).substr(
+                      0, offset + 2)),
+                  std::string_view::npos);
+    }
+}
@@ -0,0 +1,39 @@
+/**
+ * @file prefilter.test.h
+ * @author Carlos Salguero
+ * @brief Tests for Prefilter class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef PREFILTER_TEST_H
+#define PREFILTER_TEST_H
+
+// C++ Standard Library
+#include <string>
+
+// Google Test
+#include <gtest/gtest.h>
+
+// Project files
+#include "../src/matcher/prefilter.h"
+
+// Test class
+/**
+ * @class PrefilterTest
+ * @brief Tests for Prefilter class
+ * @extends ::testing::Test
+ */
+class PrefilterTest : public ::testing::Test
+{
+protected:
+    std::string haystack;
+
+    // Methods
+    void SetUp() override;
+};
+
+#endif //! PREFILTER_TEST_H
@@ -0,0 +1,208 @@
+/**
+ * @file regex.test.cpp
+ * @author Carlos Salguero
+ * @brief Implementation of RegexTest class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+// Project file
+#include "regex.test.h"
+
+// Methods
+/**
+ * @brief
+ * Set up the test fixture with every string over {a, b, c} up to length 6
+ */
+void RegexTest::SetUp()
+{
+    inputs = {""};
+
+    for (std::size_t i = 0; i < inputs.size(); i++)
+        if (inputs[i].size() < 6)
+            for (const char &character : std::string("abc"))
+                inputs.push_back(inputs[i] + character);
+}
+
+/**
+ * @brief
+ * Checks a compiled expression against the plain DFA of its expression
+ * @param regex Compiled expression
+ */
+void RegexTest::expect_same_as_dfa(const Regex &regex)
+{
+    Automata automata(regex.get_expression());
+    Matcher matcher(*automata.transform_dfa());
+
+    for (const std::string &input : inputs)
+    {
+        EXPECT_EQ(regex.match(input), matcher.match(input))
+            << regex.get_expression() << " on " << input;
+        EXPECT_EQ(regex.find(input), matcher.find(input))
+            << regex.get_expression() << " on " << input;
+    }
+}
+
+// Tests
+// Test small expressions run on the bit-parallel engine
+TEST_F(RegexTest, BitParallelEngine)
+{
+    const std::string expressions[] = {"(a|b)*abb", "a+b*", "(ab|a)*c",
+                                       "a*", "((a|b)(a|b))*c+"};
+
+    for (const std::string &expression : expressions)
+    {
+        Regex regex(expression);
+
+        EXPECT_EQ(regex.get_engine(), Engine::BIT_PARALLEL);
+        expect_same_as_dfa(regex);
+    }
+}
+
+// Test expressions with more positions than a word run on the DFA engine
+TEST_F(RegexTest, DfaEngine)
+{
+    std::string expression = "(a|b)*c";
+
+    for (int i = 0; i < 70; i++)
+        expression += "(a|b)";
+
+    Regex regex(expression);
+
+    EXPECT_EQ(regex.get_engine(), Engine::DFA);
+    EXPECT_TRUE(regex.find(std::string(30, 'c') + std::string(70, 'a')));
+    EXPECT_FALSE(regex.find(std::string(69, 'a') + "c" + std::string(69, 'b')));
+}
+
+// Test the required literal rejects inputs and skips to the prefix
+TEST_F(RegexTest, Prefilter)
+{
+    Regex suffix("(a|b)*abb");
+    Regex prefix("abc(a|b)*");
+
+    EXPECT_EQ(suffix.get_prefilter().get_literal(), "abb");
+    EXPECT_FALSE(suffix.find("ababababa"));
+    EXPECT_EQ(suffix.find("xxababbab"), std::optional<std::size_t>(7));
+
+    EXPECT_EQ(prefix.get_prefilter().get_literal(), "abc");
+    EXPECT_EQ(prefix.find("ababcab"), std::optional<std::size_t>(5));
+    EXPECT_FALSE(prefix.find("ababab"));
+}
+
+// Test classes, the dot and escapes behave the same on every engine
+TEST_F(RegexTest, Classes)
+{
+    for (const std::string expression :
+         {"[ab]*c", "[^a]+", "a.c", "\\w\\W?", "[a-c]|\\x61b"})
+        expect_same_as_dfa(Regex(expression));
+
+    Regex regex("[0-9]+\\.[0-9]+");
+
+    EXPECT_TRUE(regex.find("version 12.5"));
+    EXPECT_FALSE(regex.find("version 125"));
+    EXPECT_FALSE(Regex("a.b").find("a\nb"));
+}
+
+// Test an uppercase E matches itself rather than the empty string
+TEST_F(RegexTest, LiteralE)
+{
+    Regex error("ERROR");
+
+    EXPECT_TRUE(error.match("ERROR"));
+    EXPECT_FALSE(error.match("RROR"));
+    EXPECT_TRUE(Regex("GET").find("GET /index"));
+    EXPECT_FALSE(Regex("GET").find("GT /index"));
+    EXPECT_TRUE(Regex("a|E").match("E"));
+    EXPECT_FALSE(Regex("a|E").match(""));
+}
+
+// Test an empty class matches nothing on every engine, as in StaticRegex
+TEST_F(RegexTest, EmptyClass)
+{
+    for (const std::string expression :
+         {"a[^\\x00-\\xff]b", "[^\\x00-\\xff]", "a|[^\\x00-\\xff]*c"})
+        expect_same_as_dfa(Regex(expression));
+
+    EXPECT_FALSE(Regex("a[^\\x00-\\xff]b").find("ab"));
+    EXPECT_FALSE(Regex("[^\\x00-\\xff]").match(""));
+    EXPECT_TRUE(Regex("a|[^\\x00-\\xff]*c").match("c"));
+}
+
+// Test counted repetitions match the same strings as their expansions
+TEST_F(RegexTest, CountedRepetition)
+{
+    const std::vector<std::pair<std::string, std::string>> expansions = {
+        {"a{3}", "aaa"},
+        {"(ab|c){1,3}", "(ab|c)((ab|c)(ab|c)?)?"},
+        {"(a|bc){2,}", "(a|bc)(a|bc)+"},
+        {"a?b?c", "(a|)(b|)c"},
+        {"(a*b){0,2}", "(a*b(a*b)?)?"}};
+
+    for (const auto &[expression, expansion] : expansions)
+    {
+        Regex regex(expression);
+        Regex expanded(expansion);
+
+        for (const std::string &input : inputs)
+        {
+            EXPECT_EQ(regex.match(input), expanded.match(input))
+                << expression << " on " << input;
+            EXPECT_EQ(regex.find(input), expanded.find(input))
+                << expression << " on " << input;
+        }
+    }
+}
+
+// Test expressions whose DFA exceeds the state budget run on the lazy engine
+TEST_F(RegexTest, LazyEngine)
+{
+    Regex regex("(a|b)*a(a|b){70}");
+
+    EXPECT_EQ(regex.get_engine(), Engine::LAZY_DFA);
+    EXPECT_TRUE(regex.match("ba" + std::string(70, 'b')));
+    EXPECT_FALSE(regex.match(std::string(71, 'b')));
+    EXPECT_EQ(regex.find("cc" + std::string(71, 'a')), 73);
+
+    Regex small("(a|b)*c(a|b){70}|c(ab)*", 4);
+
+    EXPECT_EQ(small.get_engine(), Engine::LAZY_DFA);
+    expect_same_as_dfa(small);
+}
+
+// Test one compiled expression and its copies serve many threads at once
+TEST_F(RegexTest, SharedAcrossThreads)
+{
+    const Regex patterns[] = {Regex("(a|b)*a(a|b){70}|c(a|b)c"),
+                              Regex("(a|b)*c(a|b){70}|b{2,3}c")};
+
+    for (const Regex &regex : patterns)
+    {
+        std::vector<std::optional<std::size_t>> expected;
+
+        for (const std::string &input : inputs)
+            expected.push_back(regex.find(input));
+
+        std::vector<std::thread> workers;
+        std::vector<int> mismatches(8, 0);
+
+        for (int worker = 0; worker < 8; worker++)
+            workers.emplace_back([&, worker, copy = regex]()
+                                 {
+                MatchScratch scratch;
+                const Regex &shared = worker % 2 == 0 ? regex : copy;
+
+                for (int round = 0; round < 4; round++)
+                    for (std::size_t i = 0; i < inputs.size(); i++)
+                        if (shared.find(inputs[i], scratch) != expected[i])
+                            mismatches[worker]++; });
+
+        for (std::thread &worker : workers)
+            worker.join();
+
+        for (const int &count : mismatches)
+            EXPECT_EQ(count, 0) << regex.get_expression();
+    }
+}
@@ -0,0 +1,45 @@
+/**
+ * @file regex.test.h
+ * @author Carlos Salguero
+ * @brief Tests for Regex class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef REGEX_TEST_H
+#define REGEX_TEST_H
+
+// C++ Standard Library
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// Google Test
+#include <gtest/gtest.h>
+
+// Project files
+#include "../src/automata/automata.h"
+#include "../src/matcher/matcher.h"
+#include "../src/regex/regex.h"
+
+// Test class
+/**
+ * @class RegexTest
+ * @brief Tests for Regex class
+ * @extends ::testing::Test
+ */
+class RegexTest : public ::testing::Test
+{
+protected:
+    std::vector<std::string> inputs;
+
+    // Methods
+    void SetUp() override;
+    void expect_same_as_dfa(const Regex &);
+};
+
+#endif //! REGEX_TEST_H
@@ -0,0 +1,107 @@
+/**
+ * @file regex_cache.test.cpp
+ * @author Carlos Salguero
+ * @brief Implementation of RegexCacheTest class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+// C++ Standard Library
+#include <stdexcept>
+
+// Project file
+#include "regex_cache.test.h"
+
+// Methods
+/**
+ * @brief
+ * Set up the test fixture with an empty cache of the default budget
+ */
+void RegexCacheTest::SetUp()
+{
+    cache = std::make_unique<RegexCache>();
+}
+
+// Tests
+// Test a repeated lookup returns the same compiled expression
+TEST_F(RegexCacheTest, Hit)
+{
+    std::shared_ptr<const Regex> first = cache->get("(a|b)*abb");
+    std::shared_ptr<const Regex> second = cache->get("(a|b)*abb");
+
+    EXPECT_EQ(first, second);
+    EXPECT_TRUE(first->match("babb"));
+    EXPECT_EQ(cache->get_stats().hits, 1);
+    EXPECT_EQ(cache->get_stats().misses, 1);
+    EXPECT_EQ(cache->get_stats().entries, 1);
+}
+
+// Test spellings of the same simplified expression share an entry, and
+// different options do not
+TEST_F(RegexCacheTest, Normalized)
+{
+    std::shared_ptr<const Regex> regex = cache->get("a|b");
+
+    EXPECT_EQ(cache->get("[ab]"), regex);
+    EXPECT_EQ(cache->get("((a)|b)"), regex);
+    EXPECT_NE(cache->get("a|b", 4), regex);
+    EXPECT_EQ(cache->get_stats().misses, 2);
+    EXPECT_EQ(cache->get_stats().entries, 2);
+}
+
+// Test the least recently used entry is evicted first and stays valid
+TEST_F(RegexCacheTest, Eviction)
+{
+    std::shared_ptr<const Regex> abc = cache->get("abc");
+    std::shared_ptr<const Regex> abd = cache->get("abd");
+
+    cache->set_memory_budget(cache->get_stats().memory_usage);
+    cache->get("abc");
+    cache->get("abe");
+
+    EXPECT_EQ(cache->get_stats().evictions, 1);
+    EXPECT_EQ(cache->get("abc"), abc);
+    EXPECT_NE(cache->get("abd"), abd);
+    EXPECT_TRUE(abd->match("abd"));
+
+    cache->set_memory_budget(0);
+
+    EXPECT_EQ(cache->get_stats().entries, 1);
+    EXPECT_LE(cache->get_stats().memory_usage, abd->get_memory_usage() + 256);
+}
+
+// Test malformed expressions throw and are not cached
+TEST_F(RegexCacheTest, Malformed)
+{
+    EXPECT_THROW(cache->get("(ab"), std::invalid_argument);
+    EXPECT_EQ(cache->get_stats().entries, 0);
+}
+
+// Test threads looking up the same expressions get the same handles
+TEST_F(RegexCacheTest, Concurrent)
+{
+    const std::vector<std::string> patterns = {"a+b", "(ab)*c", "[0-9]{2,4}",
+                                               "x|y|z"};
+    std::vector<std::vector<std::shared_ptr<const Regex>>> handles(8);
+    std::vector<std::thread> workers;
+
+    for (std::size_t worker = 0; worker < handles.size(); worker++)
+        workers.emplace_back([&, worker]()
+                             {
+            for (int round = 0; round < 16; round++)
+                for (const std::string &pattern : patterns)
+                    handles[worker].push_back(cache->get(pattern)); });
+
+    for (std::thread &worker : workers)
+        worker.join();
+
+    for (const std::vector<std::shared_ptr<const Regex>> &worker : handles)
+        for (std::size_t i = 0; i < worker.size(); i++)
+            EXPECT_EQ(worker[i], handles[0][i % patterns.size()]);
+
+    EXPECT_EQ(cache->get_stats().entries, patterns.size());
+    EXPECT_EQ(&RegexCache::global(), &RegexCache::global());
+}
@@ -0,0 +1,42 @@
+/**
+ * @file regex_cache.test.h
+ * @author Carlos Salguero
+ * @brief Tests for RegexCache class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef REGEX_CACHE_TEST_H
+#define REGEX_CACHE_TEST_H
+
+// C++ Standard Library
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Google Test
+#include <gtest/gtest.h>
+
+// Project files
+#include "../src/regex/regex_cache.h"
+
+// Test class
+/**
+ * @class RegexCacheTest
+ * @brief Tests for RegexCache class
+ * @extends ::testing::Test
+ */
+class RegexCacheTest : public ::testing::Test
+{
+protected:
+    std::unique_ptr<RegexCache> cache;
+
+    // Methods
+    void SetUp() override;
+};
+
+#endif //! REGEX_CACHE_TEST_H
@@ -0,0 +1,107 @@
+/**
+ * @file simplifier.test.cpp
+ * @author Carlos Salguero
+ * @brief Implementation of SimplifierTest class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+// C++ Standard Library
+#include <string>
+
+// Project file
+#include "simplifier.test.h"
+#include "../src/automata/automata.h"
+#include "../src/matcher/matcher.h"
+
+// Methods
+/**
+ * @brief
+ * Parses and simplifies an expression and spells its tree back
+ * @param expression Regular expression
+ * @return std::string simplified expression
+ */
+std::string SimplifierTest::simplify(const std::string &expression) const
+{
+    return Simplifier(Parser(expression).parse()).simplify().to_string();
+}
+
+// Tests
+// Test nested concatenations and alternations are flattened
+TEST_F(SimplifierTest, Flatten)
+{
+    EXPECT_EQ(simplify("(a(b(c)))"), "abc");
+    EXPECT_EQ(simplify("(ab|(cd|(ef|gh)))"), "ab|cd|ef|gh");
+    EXPECT_EQ(simplify("a()b()"), "ab");
+}
+
+// Test repeated alternatives are dropped
+TEST_F(SimplifierTest, Dedupe)
+{
+    EXPECT_EQ(simplify("ab|cd|ab|(cd)"), "ab|cd");
+    EXPECT_EQ(simplify("(xy)*|(xy)*"), "(xy)*");
+}
+
+// Test common prefixes of alternatives are factored
+TEST_F(SimplifierTest, FactorPrefixes)
+{
+    EXPECT_EQ(simplify("abc|abd"), "ab[cd]");
+    EXPECT_EQ(simplify("abc|abd|x|abe"), "ab[c-e]|x");
+    EXPECT_EQ(simplify("ab|abc"), "ab(|c)");
+    EXPECT_EQ(simplify("get|getx|put"), "get(|x)|put");
+}
+
+// Test alternatives of single bytes merge into one class
+TEST_F(SimplifierTest, MergeClasses)
+{
+    EXPECT_EQ(simplify("a|b|c|d"), "[a-d]");
+    EXPECT_EQ(simplify("[a-c]|x|d"), "[a-dx]");
+    EXPECT_EQ(simplify("ab|c|d"), "ab|[cd]");
+    EXPECT_EQ(simplify("a|[^a]"), "[\\x00-\\xff]");
+}
+
+// Test nested repetitions collapse
+TEST_F(SimplifierTest, CollapseRepetitions)
+{
+    EXPECT_EQ(simplify("(a*)*"), "a*");
+    EXPECT_EQ(simplify("(a+)*"), "a*");
+    EXPECT_EQ(simplify("(a*)+"), "a*");
+    EXPECT_EQ(simplify("(a+)+"), "a+");
+    EXPECT_EQ(simplify("(a*|b)*"), "[ab]*");
+    EXPECT_EQ(simplify("(|a)+"), "a*");
+    EXPECT_EQ(simplify("|a*"), "a*");
+}
+
+// Test counted repetitions that are plain stars, pluses or copies
+TEST_F(SimplifierTest, CountedRepetitions)
+{
+    EXPECT_EQ(simplify("a{0,}"), "a*");
+    EXPECT_EQ(simplify("a{1,}"), "a+");
+    EXPECT_EQ(simplify("(ab){1}"), "ab");
+    EXPECT_EQ(simplify("a{0}b"), "b");
+    EXPECT_EQ(simplify("(a*){3,5}"), "a*");
+    EXPECT_EQ(simplify("(a?)?"), "a?");
+    EXPECT_EQ(simplify("(a{1,4})*"), "a*");
+    EXPECT_EQ(simplify("(a{2,4})*"), "a{2,4}*");
+}
+
+// Test simplification shrinks the NFA without changing the language
+TEST_F(SimplifierTest, SmallerNfa)
+{
+    std::string expression = "(abcdef|abcdeg|abcdeh|abcdei)*";
+    Automata automata(expression);
+    std::shared_ptr<Graph> nfa = automata.build();
+
+    // 24 literals alone would take 48 vertexes unfactored
+    EXPECT_EQ(nfa->get_next(), 14);
+
+    Matcher matcher(*automata.transform_dfa());
+
+    EXPECT_TRUE(matcher.match("abcdefabcdei"));
+    EXPECT_TRUE(matcher.match(""));
+    EXPECT_FALSE(matcher.match("abcde"));
+    EXPECT_FALSE(matcher.match("abcdefabcdej"));
+}
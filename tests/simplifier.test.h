@@ -0,0 +1,38 @@
+/**
+ * @file simplifier.test.h
+ * @author Carlos Salguero
+ * @brief Tests for Simplifier class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef SIMPLIFIER_TEST_H
+#define SIMPLIFIER_TEST_H
+
+// C++ Standard Library
+#include <string>
+
+// Google Test
+#include <gtest/gtest.h>
+
+// Project files
+#include "../src/parser/parser.h"
+#include "../src/parser/simplifier.h"
+
+// Test class
+/**
+ * @class SimplifierTest
+ * @brief Tests for Simplifier class
+ * @extends ::testing::Test
+ */
+class SimplifierTest : public ::testing::Test
+{
+protected:
+    // Methods
+    std::string simplify(const std::string &) const;
+};
+
+#endif //! SIMPLIFIER_TEST_H
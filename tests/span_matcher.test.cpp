@@ -0,0 +1,110 @@
+/**
+ * @file span_matcher.test.cpp
+ * @author Carlos Salguero
+ * @brief Implementation of SpanMatcherTest class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+// C++ Standard Library
+#include <stdexcept>
+
+// Project file
+#include "span_matcher.test.h"
+
+// Methods
+/**
+ * @brief
+ * Finds every match of an expression with a SpanMatcher
+ * @param expression Regular expression
+ * @param input Input to be searched
+ * @return std::vector<MatchSpan> matches found
+ */
+std::vector<MatchSpan> SpanMatcherTest::find_all(const std::string &expression,
+                                                 const std::string &input)
+{
+    return SpanMatcher(*Automata(expression).build()).find_all(input);
+}
+
+/**
+ * @brief
+ * Finds every leftmost-longest match by matching every substring
+ * @param expression Regular expression
+ * @param input Input to be searched
+ * @return std::vector<MatchSpan> expected matches
+ */
+std::vector<MatchSpan> SpanMatcherTest::expected(const std::string &expression,
+                                                 const std::string &input)
+{
+    Matcher matcher(*Automata(expression).transform_dfa());
+    std::string_view view(input);
+    std::vector<MatchSpan> matches;
+
+    for (std::size_t from = 0; from <= input.size();)
+    {
+        bool found = false;
+
+        for (std::size_t start = from; start <= input.size() && !found; start++)
+            for (std::size_t end = input.size() + 1; end-- > start;)
+                if (matcher.match(view.substr(start, end - start)))
+                {
+                    matches.push_back({start, end});
+                    from = end > start ? end : end + 1;
+                    found = true;
+                    break;
+                }
+
+        if (!found)
+            break;
+    }
+
+    return matches;
+}
+
+// Tests
+// Test find_all() reports the leftmost start and the longest end
+TEST_F(SpanMatcherTest, LeftmostLongest)
+{
+    EXPECT_EQ(find_all("abcd|c", "xabcd"), std::vector<MatchSpan>({{1, 5}}));
+    EXPECT_EQ(find_all("a|ab|abc", "abcab"),
+              std::vector<MatchSpan>({{0, 3}, {3, 5}}));
+    EXPECT_EQ(find_all("ab*c", "xxabbcyac"),
+              std::vector<MatchSpan>({{2, 6}, {7, 9}}));
+    EXPECT_TRUE(find_all("ab*c", "xxabbyb").empty());
+}
+
+// Test empty matches advance one byte and may follow a longer match
+TEST_F(SpanMatcherTest, EmptyMatches)
+{
+    EXPECT_EQ(find_all("a*", "baaa"),
+              std::vector<MatchSpan>({{0, 0}, {1, 4}, {4, 4}}));
+    EXPECT_EQ(find_all("x?", ""), std::vector<MatchSpan>({{0, 0}}));
+
+    SpanMatcher spans(*Automata("x*").build());
+
+    EXPECT_EQ(spans.find_all("axxbx", true),
+              std::vector<MatchSpan>({{1, 3}, {4, 5}}));
+    EXPECT_TRUE(spans.find_all("abc", true).empty());
+}
+
+// Test find_all() agrees with matching every substring
+TEST_F(SpanMatcherTest, SameAsBruteForce)
+{
+    const std::vector<std::string> expressions = {
+        "(a|b)*abb", "[0-9]+(\\.[0-9]+)?", "a(b|c)*d?", "(ab|a)(bc|c)?"};
+    const std::string input = "abbaabb 3.14 15. acbd abcabc aab";
+
+    for (const std::string &expression : expressions)
+        EXPECT_EQ(find_all(expression, input), expected(expression, input))
+            << expression;
+}
+
+// Test a state budget too small for either DFA throws
+TEST_F(SpanMatcherTest, Budget)
+{
+    EXPECT_THROW(SpanMatcher(*Automata("(a|b)*a(a|b){8}").build(), 64),
+                 std::length_error);
+}
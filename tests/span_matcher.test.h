@@ -0,0 +1,42 @@
+/**
+ * @file span_matcher.test.h
+ * @author Carlos Salguero
+ * @brief Tests for SpanMatcher class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef SPAN_MATCHER_TEST_H
+#define SPAN_MATCHER_TEST_H
+
+// C++ Standard Library
+#include <string>
+#include <vector>
+
+// Google Test
+#include <gtest/gtest.h>
+
+// Project files
+#include "../src/automata/automata.h"
+#include "../src/matcher/span_matcher.h"
+
+// Test class
+/**
+ * @class SpanMatcherTest
+ * @brief Tests for SpanMatcher class
+ * @extends ::testing::Test
+ */
+class SpanMatcherTest : public ::testing::Test
+{
+protected:
+    // Methods
+    static std::vector<MatchSpan> find_all(const std::string &,
+                                           const std::string &);
+    static std::vector<MatchSpan> expected(const std::string &,
+                                           const std::string &);
+};
+
+#endif //! SPAN_MATCHER_TEST_H
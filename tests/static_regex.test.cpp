@@ -0,0 +1,60 @@
+/**
+ * @file static_regex.test.cpp
+ * @author Carlos Salguero
+ * @brief Implementation of StaticRegexTest class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+// Project file
+#include "static_regex.test.h"
+
+// Compile-time checks
+static_assert(StaticRegex<"(a|b)*abb">::match("babb"));
+static_assert(!StaticRegex<"(a|b)*abb">::match("abba"));
+static_assert(StaticRegex<"(a|b)*abb">::find("xxabbxx") == 5);
+static_assert(StaticRegex<"(a|b)*abb">::SHAPE.states == 6);
+static_assert(StaticRegex<"ab|cd">::match("cd"));
+static_assert(!StaticRegex<"ab|cd">::match("abd"));
+static_assert(StaticRegex<"[a-f0-9]+">::match("c0ffee"));
+static_assert(StaticRegex<"[a-f0-9]+">::SHAPE.classes == 3);
+static_assert(StaticRegex<"(ab){2,3}">::match("ababab"));
+static_assert(!StaticRegex<"(ab){2,3}">::match("abababab"));
+
+// Methods
+/**
+ * @brief
+ * Set up the test fixture with every string over {a, b, c} up to length 5
+ */
+void StaticRegexTest::SetUp()
+{
+    inputs = {""};
+
+    for (std::size_t i = 0; i < inputs.size(); i++)
+        if (inputs[i].size() < 5)
+            for (const char &character : std::string("abc"))
+                inputs.push_back(inputs[i] + character);
+}
+
+// Tests
+// Test static expressions agree with the ones compiled at run time
+TEST_F(StaticRegexTest, SameAsRegex)
+{
+    expect_same_as_regex<"(a|b)*abb">("(a|b)*abb");
+    expect_same_as_regex<"a+b*">("a+b*");
+    expect_same_as_regex<"(ab)*|c+">("(ab)*|c+");
+    expect_same_as_regex<"((a*)*b)*c">("((a*)*b)*c");
+    expect_same_as_regex<"">("");
+    expect_same_as_regex<"[^b]c|.a">("[^b]c|.a");
+    expect_same_as_regex<"a{2,}b?|c{1,3}">("a{2,}b?|c{1,3}");
+}
+
+// Test the table of a small expression uses one byte per state
+TEST_F(StaticRegexTest, SmallStateType)
+{
+    EXPECT_EQ(sizeof(StaticTable<5, 3>::State), 1);
+    EXPECT_EQ(sizeof(StaticTable<300, 3>::State), 2);
+}
@@ -0,0 +1,61 @@
+/**
+ * @file static_regex.test.h
+ * @author Carlos Salguero
+ * @brief Tests for StaticRegex class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef STATIC_REGEX_TEST_H
+#define STATIC_REGEX_TEST_H
+
+// C++ Standard Library
+#include <string>
+#include <vector>
+
+// Google Test
+#include <gtest/gtest.h>
+
+// Project files
+#include "../src/regex/regex.h"
+#include "../src/regex/static_regex.h"
+
+// Test class
+/**
+ * @class StaticRegexTest
+ * @brief Tests for StaticRegex class
+ * @extends ::testing::Test
+ */
+class StaticRegexTest : public ::testing::Test
+{
+protected:
+    std::vector<std::string> inputs;
+
+    // Methods
+    void SetUp() override;
+
+    /**
+     * @brief
+     * Checks a static expression against the same expression compiled at
+     * run time, on every input
+     * @param expression Source of the static expression
+     */
+    template <FixedString Pattern>
+    void expect_same_as_regex(const std::string &expression)
+    {
+        Regex regex(expression);
+
+        for (const std::string &input : inputs)
+        {
+            EXPECT_EQ(StaticRegex<Pattern>::match(input), regex.match(input))
+                << expression << " on \"" << input << "\"";
+            EXPECT_EQ(StaticRegex<Pattern>::find(input), regex.find(input))
+                << expression << " on \"" << input << "\"";
+        }
+    }
+};
+
+#endif //! STATIC_REGEX_TEST_H
@@ -0,0 +1,120 @@
+/**
+ * @file stream_matcher.test.cpp
+ * @author Carlos Salguero
+ * @brief Implementation of StreamMatcherTest class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+// Project file
+#include "stream_matcher.test.h"
+
+// Methods
+/**
+ * @brief
+ * Set up the test fixture
+ */
+void StreamMatcherTest::SetUp()
+{
+    Automata automata("ab*c");
+    matcher = std::make_shared<const Matcher>(*automata.transform_dfa());
+}
+
+/**
+ * @brief
+ * Finds every match end and its leftmost start by matching every substring
+ * @param input Whole input
+ * @return std::vector<StreamMatch> expected matches
+ */
+std::vector<StreamMatch> StreamMatcherTest::expected(
+    const std::string &input) const
+{
+    std::vector<StreamMatch> matches;
+
+    for (std::size_t end = 1; end <= input.size(); end++)
+        for (std::size_t start = 0; start < end; start++)
+            if (matcher->match(std::string_view(input).substr(start,
+                                                              end - start)))
+            {
+                matches.push_back({start, end});
+                break;
+            }
+
+    return matches;
+}
+
+// Tests
+// Test feed() on a single chunk
+TEST_F(StreamMatcherTest, SingleChunk)
+{
+    StreamMatcher stream(matcher);
+    std::string input = "xxabbcyac";
+
+    std::vector<StreamMatch> matches = stream.feed(input);
+
+    EXPECT_EQ(matches, std::vector<StreamMatch>({{2, 6}, {7, 9}}));
+    EXPECT_EQ(stream.get_offset(), input.size());
+    EXPECT_EQ(stream.get_match_count(), 2);
+}
+
+// Test matches spanning chunk boundaries keep absolute offsets
+TEST_F(StreamMatcherTest, AcrossChunks)
+{
+    const std::string input = "cabbbbcaacabcxabbc";
+
+    for (std::size_t size = 1; size <= 5; size++)
+    {
+        StreamMatcher stream(matcher);
+        std::vector<StreamMatch> matches;
+
+        for (std::size_t i = 0; i < input.size(); i += size)
+            stream.feed(std::string_view(input).substr(i, size),
+                        [&](const StreamMatch &match)
+                        { matches.push_back(match); });
+
+        EXPECT_EQ(matches, expected(input)) << "chunk size " << size;
+    }
+}
+
+// Test overlapping matches report the leftmost start of every end
+TEST_F(StreamMatcherTest, LeftmostStart)
+{
+    Automata automata("(a|b)*b");
+    auto overlapping =
+        std::make_shared<const Matcher>(*automata.transform_dfa());
+
+    StreamMatcher stream(overlapping);
+    std::vector<StreamMatch> matches = stream.feed(std::string("cabab"));
+
+    EXPECT_EQ(matches, std::vector<StreamMatch>({{1, 3}, {1, 5}}));
+}
+
+// Test live threads stay bounded by the number of DFA states
+TEST_F(StreamMatcherTest, BoundedState)
+{
+    StreamMatcher stream(matcher);
+    std::string input(10000, 'b');
+    input[0] = 'a';
+
+    stream.feed(input);
+
+    EXPECT_LE(stream.get_thread_count(),
+              static_cast<std::size_t>(matcher->get_state_count()));
+    EXPECT_EQ(stream.feed(std::string("c")),
+              std::vector<StreamMatch>({{0, 10001}}));
+}
+
+// Test reset() moves back to offset 0
+TEST_F(StreamMatcherTest, Reset)
+{
+    StreamMatcher stream(matcher);
+
+    stream.feed(std::string("xab"));
+    stream.reset();
+
+    EXPECT_TRUE(stream.feed(std::string("c")).empty());
+    EXPECT_EQ(stream.get_offset(), 1);
+}
@@ -0,0 +1,44 @@
+/**
+ * @file stream_matcher.test.h
+ * @author Carlos Salguero
+ * @brief Tests for StreamMatcher class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef STREAM_MATCHER_TEST_H
+#define STREAM_MATCHER_TEST_H
+
+// C++ Standard Library
+#include <memory>
+#include <string>
+#include <vector>
+
+// Google Test
+#include <gtest/gtest.h>
+
+// Project files
+#include "../src/automata/automata.h"
+#include "../src/matcher/matcher.h"
+#include "../src/matcher/stream_matcher.h"
+
+// Test class
+/**
+ * @class StreamMatcherTest
+ * @brief Tests for StreamMatcher class
+ * @extends ::testing::Test
+ */
+class StreamMatcherTest : public ::testing::Test
+{
+protected:
+    std::shared_ptr<const Matcher> matcher;
+
+    // Methods
+    void SetUp() override;
+    std::vector<StreamMatch> expected(const std::string &) const;
+};
+
+#endif //! STREAM_MATCHER_TEST_H